@@ -0,0 +1,310 @@
+/*
+ * BDD.cpp : Reduced ordered binary decision diagrams for equivalence, satisfiability and model counting.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <algorithm>              // Include the library for sorting and merging.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "ExpressionDag.h"        // Include the user-defined header file that declares the expression graph.
+#include "BDD.h"                  // Include the user-defined header file that declares the BDD engine.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Constructor that creates the two terminals and empty tables.
+BddManager::BddManager(size_t cacheSize) : cache(cacheSize), buckets(1 << 12, NO_NODE) {
+    nodes.push_back({BDD_TERMINAL_VAR, BDD_FALSE, BDD_FALSE, NO_NODE});  // The false terminal.
+    nodes.push_back({BDD_TERMINAL_VAR, BDD_TRUE, BDD_TRUE, NO_NODE});    // The true terminal.
+}
+
+// Function to return the BDD of a single variable.
+BddRef BddManager::variable(uint32_t index) {
+    return makeNode(index, BDD_FALSE, BDD_TRUE);
+}
+
+// Function to return the negation of a BDD.
+BddRef BddManager::negate(BddRef a) {
+    if (a <= BDD_TRUE) return a ^ 1;           // Swap the terminals.
+    CacheEntry& entry = cache[cacheSlot(OP_NOT, a, a)];
+    if (entry.op == OP_NOT && entry.a == a && entry.valid) return entry.result;
+    BddRef low = negate(nodes[a].low);
+    BddRef high = negate(nodes[a].high);
+    BddRef result = makeNode(nodes[a].var, low, high);
+    cache[cacheSlot(OP_NOT, a, a)] = {OP_NOT, a, a, result, true};
+    return result;
+}
+
+// Function to combine two BDDs with one of the binary operators.
+BddRef BddManager::apply(Opcode op, BddRef a, BddRef b) {
+    if (op == OP_NAND) return negate(apply(OP_AND, a, b));  // NAND shares the AND results.
+
+    // Handle the cases whose answer is known without looking at either diagram.
+    switch (op) {
+        case OP_AND:
+            if (a == BDD_FALSE || b == BDD_FALSE) return BDD_FALSE;
+            if (a == BDD_TRUE || a == b) return b;
+            if (b == BDD_TRUE) return a;
+            break;
+        case OP_OR:
+            if (a == BDD_TRUE || b == BDD_TRUE) return BDD_TRUE;
+            if (a == BDD_FALSE || a == b) return b;
+            if (b == BDD_FALSE) return a;
+            break;
+        case OP_XOR:
+            if (a == b) return BDD_FALSE;
+            if (a == BDD_FALSE) return b;
+            if (b == BDD_FALSE) return a;
+            if (a == BDD_TRUE) return negate(b);
+            if (b == BDD_TRUE) return negate(a);
+            break;
+        default:
+            throw invalid_argument("Unsupported BDD operation");
+    }
+    if (a > b) swap(a, b);                     // Every remaining operation is commutative.
+
+    size_t slot = cacheSlot(op, a, b);
+    if (cache[slot].valid && cache[slot].op == op && cache[slot].a == a && cache[slot].b == b) {
+        return cache[slot].result;             // Reuse an earlier result.
+    }
+
+    uint32_t top = min(nodes[a].var, nodes[b].var);  // Split on the earliest variable of either operand.
+    BddRef aLow = (nodes[a].var == top) ? nodes[a].low : a;
+    BddRef aHigh = (nodes[a].var == top) ? nodes[a].high : a;
+    BddRef bLow = (nodes[b].var == top) ? nodes[b].low : b;
+    BddRef bHigh = (nodes[b].var == top) ? nodes[b].high : b;
+    BddRef low = apply(op, aLow, bLow);
+    BddRef high = apply(op, aHigh, bHigh);
+    BddRef result = makeNode(top, low, high);
+
+    cache[cacheSlot(op, a, b)] = {op, a, b, result, true};
+    return result;
+}
+
+// Function to build the BDD of compiled bytecode. levels[i] is the variable index used for variable i.
+BddRef BddManager::build(const CompiledExpression& program, const vector<uint32_t>& levels) {
+    vector<BddRef> stack;     // Stack of partial results, also treated as roots during collection.
+    const vector<uint8_t>& code = program.code;
+    for (size_t i = 0; i < code.size(); ++i) {
+        switch (code[i]) {
+            case OP_PUSH_TRUE:  stack.push_back(BDD_TRUE); break;
+            case OP_PUSH_FALSE: stack.push_back(BDD_FALSE); break;
+            case OP_LOAD_VAR:   stack.push_back(variable(levels[code[++i]])); break;
+            case OP_NOT:        stack.back() = negate(stack.back()); break;
+            default: {        // Binary operators.
+                BddRef right = stack.back();
+                stack.pop_back();
+                stack.back() = apply(static_cast<Opcode>(code[i]), stack.back(), right);
+                if (liveNodes() > collectThreshold) collectGarbage(stack);
+            }
+        }
+    }
+    return stack.back();
+}
+
+// Function to allow a protected BDD to be collected again.
+void BddManager::release(BddRef a) {
+    auto it = roots.find(a);
+    if (it != roots.end() && --it->second == 0) roots.erase(it);
+}
+
+// Function to free every node not reachable from a protected BDD or from the extra roots.
+void BddManager::collectGarbage(const vector<BddRef>& extraRoots) {
+    vector<bool> marked(nodes.size(), false);
+    marked[BDD_FALSE] = marked[BDD_TRUE] = true;
+    vector<BddRef> pending(extraRoots);       // Nodes whose children still need marking.
+    for (auto& root : roots) pending.push_back(root.first);
+    while (!pending.empty()) {
+        BddRef a = pending.back();
+        pending.pop_back();
+        if (marked[a]) continue;
+        marked[a] = true;
+        pending.push_back(nodes[a].low);
+        pending.push_back(nodes[a].high);
+    }
+
+    // Put every unmarked node on the free list and rebuild the unique table from the survivors.
+    fill(buckets.begin(), buckets.end(), NO_NODE);
+    freeList = NO_NODE;
+    freeCount = 0;
+    for (BddRef a = static_cast<BddRef>(nodes.size()); a-- > BDD_TRUE + 1;) {
+        if (marked[a]) {
+            insertUnique(a);
+        } else {
+            nodes[a] = {BDD_FREE_VAR, BDD_FALSE, BDD_FALSE, freeList};
+            freeList = a;
+            ++freeCount;
+        }
+    }
+    for (CacheEntry& entry : cache) entry.valid = false;  // Cached results may name freed nodes.
+    collectThreshold = max<size_t>(collectThreshold, liveNodes() * 2);  // Avoid collecting again right away.
+}
+
+// Function to return the number of nodes reachable from a BDD, including terminals.
+size_t BddManager::size(BddRef a) const {
+    vector<bool> seen(nodes.size(), false);
+    vector<BddRef> pending{a};
+    size_t count = 0;
+    while (!pending.empty()) {
+        BddRef n = pending.back();
+        pending.pop_back();
+        if (seen[n]) continue;
+        seen[n] = true;
+        ++count;
+        if (n > BDD_TRUE) {
+            pending.push_back(nodes[n].low);
+            pending.push_back(nodes[n].high);
+        }
+    }
+    return count;
+}
+
+// Function to count the assignments of variables 0..variableCount-1 that make a BDD true.
+uint64_t BddManager::satCount(BddRef a, uint32_t variableCount) {
+    if (variableCount > 63) throw runtime_error("Too many variables to count assignments");
+    unordered_map<BddRef, uint64_t> memo;      // Count for each node over the variables below it.
+    return countBelow(a, variableCount, memo) << levelOf(a, variableCount);
+}
+
+// Function to find one assignment that makes a BDD true, returning false if there is none.
+// Variables the path does not test are left false.
+bool BddManager::anySat(BddRef a, uint32_t variableCount, vector<bool>& assignment) const {
+    assignment.assign(variableCount, false);
+    if (a == BDD_FALSE) return false;
+    while (a > BDD_TRUE) {                     // Follow any branch that does not lead to false.
+        bool takeHigh = nodes[a].high != BDD_FALSE;
+        assignment[nodes[a].var] = takeHigh;
+        a = takeHigh ? nodes[a].high : nodes[a].low;
+    }
+    return true;
+}
+
+// Function to hash a node's fields into a bucket index.
+size_t BddManager::bucketOf(uint32_t var, BddRef low, BddRef high) const {
+    uint64_t h = (static_cast<uint64_t>(var) * 0x9E3779B97F4A7C15ULL) ^ (static_cast<uint64_t>(low) * 0xC2B2AE3D27D4EB4FULL) ^ high;
+    return static_cast<size_t>((h ^ (h >> 29)) & (buckets.size() - 1));
+}
+
+// Function to hash an operation and its operands into a cache slot.
+size_t BddManager::cacheSlot(uint32_t op, BddRef a, BddRef b) const {
+    uint64_t h = (static_cast<uint64_t>(a) << 32 | b) * 0x9E3779B97F4A7C15ULL + op;
+    return static_cast<size_t>((h >> 17) % cache.size());
+}
+
+// Function to link a node into the unique table.
+void BddManager::insertUnique(BddRef a) {
+    size_t bucket = bucketOf(nodes[a].var, nodes[a].low, nodes[a].high);
+    nodes[a].next = buckets[bucket];
+    buckets[bucket] = a;
+}
+
+// Function to return the unique node with the given fields, creating it only if it does not exist.
+BddRef BddManager::makeNode(uint32_t var, BddRef low, BddRef high) {
+    if (low == high) return low;               // A test whose branches agree is redundant.
+    for (BddRef a = buckets[bucketOf(var, low, high)]; a != NO_NODE; a = nodes[a].next) {
+        if (nodes[a].var == var && nodes[a].low == low && nodes[a].high == high) return a;
+    }
+
+    BddRef a;
+    if (freeList != NO_NODE) {                 // Reuse a collected node when one is available.
+        a = freeList;
+        freeList = nodes[a].next;
+        --freeCount;
+        nodes[a] = {var, low, high, NO_NODE};
+    } else {
+        a = static_cast<BddRef>(nodes.size());
+        nodes.push_back({var, low, high, NO_NODE});
+    }
+    insertUnique(a);
+    if (liveNodes() > buckets.size() * 2) rehash();  // Keep the chains short.
+    return a;
+}
+
+// Function to double the unique table and relink every live node.
+void BddManager::rehash() {
+    buckets.assign(buckets.size() * 2, NO_NODE);
+    for (BddRef a = BDD_TRUE + 1; a < nodes.size(); ++a) {
+        if (nodes[a].var != BDD_FREE_VAR) insertUnique(a);
+    }
+}
+
+// Function to return the level of a node, treating terminals as lying below the last variable.
+uint32_t BddManager::levelOf(BddRef a, uint32_t variableCount) const {
+    return (a <= BDD_TRUE) ? variableCount : nodes[a].var;
+}
+
+// Function to count satisfying assignments of the variables from a node's level down.
+uint64_t BddManager::countBelow(BddRef a, uint32_t variableCount, unordered_map<BddRef, uint64_t>& memo) {
+    if (a <= BDD_TRUE) return a;
+    auto it = memo.find(a);
+    if (it != memo.end()) return it->second;
+    uint32_t level = nodes[a].var;
+    BddRef low = nodes[a].low;
+    BddRef high = nodes[a].high;
+    // Variables skipped between a node and its child can take either value.
+    uint64_t count = (countBelow(low, variableCount, memo) << (levelOf(low, variableCount) - level - 1))
+                   + (countBelow(high, variableCount, memo) << (levelOf(high, variableCount) - level - 1));
+    memo[a] = count;
+    return count;
+}
+
+// Function to build the BDDs of the given expressions over the union of their variables.
+void buildBddAnalysis(const vector<string>& expressions, const BooleanDefinitions& definitions, BddAnalysis& analysis) {
+    vector<CompiledExpression> programs;
+    for (const string& expression : expressions) {
+        programs.push_back(compileExpression(expression, definitions, true));  // Parse once, allowing variables.
+        analysis.variables += programs.back().variables;
+    }
+    sort(analysis.variables.begin(), analysis.variables.end());
+    analysis.variables.erase(unique(analysis.variables.begin(), analysis.variables.end()), analysis.variables.end());
+
+    for (const CompiledExpression& program : programs) {
+        vector<uint32_t> levels;  // Shared index of each of the program's variables.
+        for (char name : program.variables) levels.push_back(static_cast<uint32_t>(analysis.variables.find(name)));
+        analysis.roots.push_back(analysis.manager.build(program, levels));
+        analysis.manager.protect(analysis.roots.back());
+    }
+}
+
+// Function to format an assignment as "A=1 B=0 ...".
+string formatAssignment(const string& variables, const vector<bool>& assignment) {
+    string text;
+    for (size_t i = 0; i < variables.size(); ++i) {
+        if (i > 0) text += ' ';
+        text += variables[i];
+        text += assignment[i] ? "=1" : "=0";
+    }
+    return text.empty() ? "(no variables)" : text;
+}
+
+// Function to print satisfiability, the model count and a witness, plus equivalence when two expressions are given.
+void printBddAnalysis(const string& first, const string& second, const BooleanDefinitions& definitions) {
+    BddAnalysis analysis;
+    vector<string> expressions{first};
+    if (!second.empty()) expressions.push_back(second);
+    buildBddAnalysis(expressions, definitions, analysis);
+
+    uint32_t variableCount = static_cast<uint32_t>(analysis.variables.size());
+    BddRef f = analysis.roots[0];
+    vector<bool> witness;
+    ExpressionDag dag(compileExpression(first, definitions, true));  // Report how much simplification and sharing removes.
+    cout << "Expression nodes: " << dag.sourceNodes() << " (" << dag.dagNodes() << " after simplification, "
+         << dag.eliminatedNodes() << " eliminated)" << endl;
+    cout << "BDD nodes: " << analysis.manager.size(f) << endl;
+    cout << "Satisfiable: " << (f != BDD_FALSE ? "Yes" : "No") << endl;
+    cout << "Satisfying assignments: " << analysis.manager.satCount(f, variableCount)
+         << " of 2^" << variableCount << endl;
+    if (analysis.manager.anySat(f, variableCount, witness)) {
+        cout << "Witness: " << formatAssignment(analysis.variables, witness) << endl;
+    }
+
+    if (analysis.roots.size() > 1) {  // Canonical BDDs are equal exactly when the expressions are equivalent.
+        BddRef g = analysis.roots[1];
+        cout << "Equivalent: " << (f == g ? "Yes" : "No") << endl;
+        if (f != g && analysis.manager.anySat(analysis.manager.apply(OP_XOR, f, g), variableCount, witness)) {
+            cout << "Differ at: " << formatAssignment(analysis.variables, witness) << endl;
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef BDD_H
+#define BDD_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <unordered_map>          // Include the library for the hash map container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "Bytecode.h"             // Include the user-defined header file that declares the bytecode format.
+
+typedef uint32_t BddRef;          // Index of a node in the manager's node pool.
+
+const BddRef BDD_FALSE = 0;                 // Terminal node for false.
+const BddRef BDD_TRUE = 1;                  // Terminal node for true.
+const uint32_t BDD_TERMINAL_VAR = UINT32_MAX;  // Variable level given to the two terminals, below every variable.
+const uint32_t BDD_FREE_VAR = UINT32_MAX - 1;  // Variable level marking a node on the free list.
+
+// Class that owns a pool of hash-consed BDD nodes, an apply cache and a mark-and-sweep collector.
+// Variables are ordered by index, so a variable with a smaller index is tested first.
+class BddManager {
+public:
+    explicit BddManager(size_t cacheSize = 1 << 16);  // Create the two terminals and empty tables.
+
+    BddRef variable(uint32_t index);                  // Return the BDD of a single variable.
+    BddRef negate(BddRef a);                          // Return the negation of a BDD.
+    BddRef apply(Opcode op, BddRef a, BddRef b);      // Combine two BDDs with one of the binary operators.
+
+    // Build the BDD of compiled bytecode. levels[i] is the variable index used for variable i.
+    BddRef build(const CompiledExpression& program, const std::vector<uint32_t>& levels);
+
+    void protect(BddRef a) { ++roots[a]; }            // Keep a BDD alive across garbage collections.
+    void release(BddRef a);                           // Allow a protected BDD to be collected again.
+
+    // Free every node not reachable from a protected BDD or from the extra roots.
+    void collectGarbage(const std::vector<BddRef>& extraRoots = {});
+
+    size_t liveNodes() const { return nodes.size() - freeCount; }  // Nodes in use, including the terminals.
+    void setCollectThreshold(size_t live) { collectThreshold = live; }  // Collect while building above this many live nodes.
+    size_t size(BddRef a) const;                      // Nodes reachable from a BDD, including terminals.
+
+    // Count the assignments of variables 0..variableCount-1 that make a BDD true.
+    uint64_t satCount(BddRef a, uint32_t variableCount);
+
+    // Find one assignment that makes a BDD true, returning false if there is none.
+    bool anySat(BddRef a, uint32_t variableCount, std::vector<bool>& assignment) const;
+
+private:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;   // Marks the end of a hash chain or of the free list.
+
+    struct BddNode {              // Define a structure for one decision node.
+        uint32_t var;             // Member holding the variable tested by the node.
+        BddRef low;               // Member holding the child taken when the variable is false.
+        BddRef high;              // Member holding the child taken when the variable is true.
+        uint32_t next;            // Member linking the node to the next one in its bucket or free list.
+    };
+
+    struct CacheEntry {           // Define a structure for one remembered apply result.
+        uint32_t op = 0;          // Member holding the operation.
+        BddRef a = 0;             // Member holding the first operand.
+        BddRef b = 0;             // Member holding the second operand.
+        BddRef result = 0;        // Member holding the result.
+        bool valid = false;       // Member recording whether the entry holds a result.
+    };
+
+    size_t bucketOf(uint32_t var, BddRef low, BddRef high) const;  // Hash a node's fields into a bucket index.
+    size_t cacheSlot(uint32_t op, BddRef a, BddRef b) const;       // Hash an operation into a cache slot.
+    void insertUnique(BddRef a);                                   // Link a node into the unique table.
+    BddRef makeNode(uint32_t var, BddRef low, BddRef high);        // Return the unique node with these fields.
+    void rehash();                                                 // Double the unique table.
+    uint32_t levelOf(BddRef a, uint32_t variableCount) const;      // Level of a node, terminals last.
+    uint64_t countBelow(BddRef a, uint32_t variableCount, std::unordered_map<BddRef, uint64_t>& memo);
+
+    std::vector<BddNode> nodes;   // Pool holding every node, live or free.
+    std::vector<CacheEntry> cache;  // Direct-mapped cache of apply and negate results.
+    std::vector<uint32_t> buckets;  // Heads of the unique table's hash chains.
+    std::unordered_map<BddRef, size_t> roots;  // Protected BDDs and how many times each was protected.
+    uint32_t freeList = NO_NODE;  // First node on the free list.
+    size_t freeCount = 0;         // Number of nodes on the free list.
+    size_t collectThreshold = 1 << 20;  // Live node count that triggers a collection while building.
+};
+
+// Structure holding the BDDs of one or two expressions over a shared variable order.
+struct BddAnalysis {
+    BddManager manager;           // Manager that owns every node.
+    std::string variables;        // Variable names, sorted; the position is the BDD variable index.
+    std::vector<BddRef> roots;    // BDD of each expression.
+};
+
+// Build the BDDs of the given expressions over the union of their variables.
+void buildBddAnalysis(const std::vector<std::string>& expressions, const BooleanDefinitions& definitions, BddAnalysis& analysis);
+
+// Format an assignment as "A=1 B=0 ...".
+std::string formatAssignment(const std::string& variables, const std::vector<bool>& assignment);
+
+// Print satisfiability, the model count and a witness, plus equivalence when a second expression is given.
+void printBddAnalysis(const std::string& first, const std::string& second, const BooleanDefinitions& definitions);
+
+#endif // BDD_H
@@ -0,0 +1,82 @@
+/*
+ * BatchInput.cpp : Memory-mapped input files shared by the modes that read large files.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <iterator>               // Include the library for stream iterators.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <fcntl.h>                // Include the POSIX library for opening files.
+#include <unistd.h>               // Include the POSIX library for closing files.
+#include <sys/mman.h>             // Include the POSIX library for memory-mapping files.
+#include <sys/stat.h>             // Include the POSIX library for querying file sizes.
+#include "BatchInput.h"           // Include the user-defined header file that declares the input mapping.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Constructor that memory-maps a file, or reads standard input when the path is "-".
+BatchInput::BatchInput(const string& path) {
+    if (path == "-") {                  // Standard input cannot be mapped, so read it into a buffer.
+        buffer.assign(istreambuf_iterator<char>(cin), istreambuf_iterator<char>());
+        data = buffer.data();
+        size = buffer.size();
+        return;
+    }
+    fd = open(path.c_str(), O_RDONLY);  // Open the input file for reading.
+    if (fd < 0) throw runtime_error("Unable to open input file: " + path);
+    struct stat info;                   // Structure to receive the file size.
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw runtime_error("Unable to read input file: " + path);
+    }
+    size = static_cast<size_t>(info.st_size);
+    if (size == 0) return;              // Empty files cannot be mapped and need no work.
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);  // Map the whole file.
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        throw runtime_error("Unable to map input file: " + path);
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);  // Hint that the file is read front to back.
+    data = static_cast<const char*>(mapping);
+    mapped = true;
+}
+
+// Destructor that releases the mapping and the file handle.
+BatchInput::~BatchInput() {
+    if (mapped) munmap(const_cast<char*>(data), size);
+    if (fd >= 0) close(fd);
+}
+
+// Function to split the input into ranges that each end on a line boundary.
+vector<LineRange> splitLineRanges(const char* data, size_t size, size_t rangeCount) {
+    vector<LineRange> ranges;
+    if (size == 0) return ranges;
+    size_t target = (size + rangeCount - 1) / rangeCount;  // Aim for ranges of equal byte length.
+    const char* end = data + size;
+    const char* begin = data;
+    while (begin < end) {
+        const char* split = (static_cast<size_t>(end - begin) > target) ? begin + target : end;
+        while (split < end && split[-1] != '\n') ++split;  // Extend the range to the end of its line.
+        ranges.push_back({begin, split});
+        begin = split;
+    }
+    return ranges;
+}
+
+// Function to open an output target, leaving standard output open when the target is released.
+BatchOutput openBatchOutput(const string& path) {
+    if (path == "-") return BatchOutput(stdout, [](FILE*) noexcept { return 0; });
+    BatchOutput out(fopen(path.c_str(), "wb"), &fclose);
+    if (!out) throw runtime_error("Unable to open output file: " + path);
+    return out;
+}
+
+// Function to flush and close an output target, reporting write errors as the modes always have.
+void closeBatchOutput(BatchOutput& out, const string& path) {
+    bool failed = fflush(out.get()) != 0;
+    failed = (out.get_deleter()(out.release()) != 0) || failed;  // Close now, so a failed close is seen.
+    if (failed) throw runtime_error("Unable to write output file: " + path);
+}
@@ -0,0 +1,109 @@
+#ifndef BATCHINPUT_H
+#define BATCHINPUT_H
+
+#include <atomic>                 // Include the library for lock-free counters and flags.
+#include <condition_variable>     // Include the library for waiting on worker progress.
+#include <cstddef>                // Include the library for size types.
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstdio>                 // Include the library for buffered C file output.
+#include <deque>                  // Include the library for the double-ended queue container.
+#include <memory>                 // Include the library for owning pointers.
+#include <mutex>                  // Include the library for mutual exclusion.
+#include <string>                 // Include the library for string manipulation.
+#include <thread>                 // Include the library for launching worker threads.
+#include <vector>                 // Include the library for the dynamic array container.
+
+// Class that exposes the whole input as one read-only block of memory.
+class BatchInput {
+public:
+    explicit BatchInput(const std::string& path);  // Map a file, or read standard input when the path is "-".
+    ~BatchInput();                                 // Release the mapping and the file handle.
+
+    BatchInput(const BatchInput&) = delete;             // The mapping is owned and must not be copied.
+    BatchInput& operator=(const BatchInput&) = delete;  // The mapping is owned and must not be copied.
+
+    const char* data = nullptr;   // Pointer to the first byte of the input.
+    size_t size = 0;              // Number of bytes in the input.
+
+private:
+    std::string buffer;           // Storage for input read from standard input.
+    int fd = -1;                  // File descriptor of the mapped file.
+    bool mapped = false;          // Whether data points into a memory mapping.
+};
+
+struct LineRange {                // Define a structure for a run of whole lines.
+    const char* begin;            // Member pointing at the first byte of the first line.
+    const char* end;              // Member pointing one past the last byte of the last line.
+};
+
+// Split the input into about rangeCount ranges of similar size that each end on a line boundary.
+std::vector<LineRange> splitLineRanges(const char* data, size_t size, size_t rangeCount);
+
+struct OrderedChunk {             // Define a structure for a range of lines and the output produced for it.
+    LineRange lines;              // Member holding the lines of the chunk.
+    std::string output;           // Member holding the output of every line in the chunk.
+    uint64_t count = 0;           // Member holding the count the worker reported for the chunk.
+    std::atomic<bool> done{false};  // Member marking whether a worker has finished the chunk.
+};
+
+// Split the input into chunks of whole lines, process them on threadCount workers (every core when zero) and
+// write each chunk's output in input order while later chunks are still being processed. Each worker thread
+// calls makeWorker() once for the state it owns alone, then calls that state as worker(lines, output) for every
+// chunk it claims; the call appends the chunk's output and returns a count. Returns the sum of the counts.
+template <typename MakeWorker>
+uint64_t runOrderedChunks(const char* data, size_t size, unsigned threadCount, MakeWorker makeWorker, FILE* out) {
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;                    // Fall back if the core count is unknown.
+    std::deque<OrderedChunk> chunks;
+    for (const LineRange& range : splitLineRanges(data, size, static_cast<size_t>(threadCount) * 16)) {
+        chunks.emplace_back();
+        chunks.back().lines = range;
+    }
+
+    std::atomic<size_t> nextChunk{0};  // Index of the next chunk waiting for a worker.
+    std::mutex doneMutex;              // Mutex guarding the completion notification.
+    std::condition_variable doneSignal;// Signal raised whenever a chunk is finished.
+
+    // Worker loop that claims chunks until none are left.
+    auto claimChunks = [&]() {
+        auto worker = makeWorker();
+        for (size_t i = nextChunk++; i < chunks.size(); i = nextChunk++) {
+            chunks[i].count = worker(chunks[i].lines, chunks[i].output);
+            {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                chunks[i].done = true;
+            }
+            doneSignal.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threadCount; ++t) workers.emplace_back(claimChunks);
+
+    // Write finished chunks in input order while later chunks are still being processed.
+    uint64_t total = 0;
+    for (OrderedChunk& chunk : chunks) {
+        {
+            std::unique_lock<std::mutex> lock(doneMutex);
+            doneSignal.wait(lock, [&]() { return chunk.done.load(); });
+        }
+        fwrite(chunk.output.data(), 1, chunk.output.size(), out);  // Write the whole chunk in one call.
+        total += chunk.count;
+        std::string().swap(chunk.output);  // Release the chunk's output once it is written.
+    }
+
+    for (std::thread& t : workers) t.join();
+    return total;
+}
+
+// Output target of a file mode, closed automatically if the mode stops early. Standard output is never closed.
+typedef std::unique_ptr<FILE, decltype(&fclose)> BatchOutput;
+
+// Open an output file for writing, or standard output when the path is "-". Modes open their output only
+// after their inputs have been opened and checked, so a failed run leaves an existing output file untouched.
+BatchOutput openBatchOutput(const std::string& path);
+
+// Flush and close an output target, throwing if anything written to it was lost.
+void closeBatchOutput(BatchOutput& out, const std::string& path);
+
+#endif // BATCHINPUT_H
@@ -0,0 +1,59 @@
+/*
+ * BatchMode.cpp : Adds a non-interactive mode that evaluates a whole file of expressions on all cores.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <string>                 // Include the library for string manipulation.
+#include <string_view>            // Include the library for non-owning string references.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "BatchInput.h"           // Include the user-defined header file that declares the input mapping.
+#include "EvalContext.h"          // Include the user-defined header file that declares the evaluation context.
+#include "BatchMode.h"            // Include the user-defined header file that declares batch mode.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to evaluate every line of a chunk and append one result line per input line.
+// Returns the number of lines evaluated.
+static uint64_t evaluateBatchChunk(const LineRange& chunk, EvalContext& context, string& output) {
+    uint64_t lines = 0;
+    const char* lineStart = chunk.begin;
+    while (lineStart < chunk.end) {
+        const char* lineEnd = lineStart;
+        while (lineEnd < chunk.end && *lineEnd != '\n') ++lineEnd;  // Find the end of the line.
+        const char* textEnd = lineEnd;
+        if (textEnd > lineStart && textEnd[-1] == '\r') --textEnd;   // Drop Windows line endings.
+        try {
+            bool result = context.evaluate(string_view(lineStart, textEnd - lineStart));  // Parse and evaluate in place.
+            output += result ? "True\n" : "False\n";
+        } catch (exception& e) {  // Report errors inline so output lines stay aligned with input lines.
+            output += "Error: ";
+            output += e.what();
+            output += '\n';
+        }
+        ++lines;
+        lineStart = lineEnd + 1;  // Move past the newline to the next line.
+    }
+    return lines;
+}
+
+// Function to evaluate every line in the input file and write the results in input order.
+int runBatch(const string& inputPath, const string& outputPath, unsigned threadCount,
+             const BooleanDefinitions& definitions) {
+    BatchInput input(inputPath);  // Map or read the whole input.
+
+    BatchOutput out = openBatchOutput(outputPath);  // Open the output target.
+
+    // Each worker owns its evaluation state, so no lock is taken per expression.
+    runOrderedChunks(input.data, input.size, threadCount, [&]() {
+        return [context = EvalContext(definitions)](const LineRange& chunk, string& output) mutable {
+            return evaluateBatchChunk(chunk, context, output);
+        };
+    }, out.get());
+    closeBatchOutput(out, outputPath);
+    return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef BATCHMODE_H
+#define BATCHMODE_H
+
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+// Evaluate every line in the input file ("-" for standard input) and write the results in input order.
+int runBatch(const std::string& inputPath, const std::string& outputPath, unsigned threadCount,
+             const BooleanDefinitions& definitions);
+
+#endif // BATCHMODE_H
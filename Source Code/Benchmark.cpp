@@ -0,0 +1,127 @@
+/*
+ * Benchmark.cpp : Measures how fast the compiled evaluators run compared to the postfix evaluator.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <iomanip>                // Include the library for manipulating output formatting.
+#include <chrono>                 // Include the library for timing.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
+#include "PostfixEval.h"          // Include the user-defined header file that declares the postfix evaluator.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "ExpressionDag.h"        // Include the user-defined header file that declares the expression graph.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "Benchmark.h"            // Include the user-defined header file that declares the benchmarks.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to time a callable that evaluates every expression once, returning nanoseconds per expression.
+template <typename Evaluate>
+static double timePerExpression(size_t expressionCount, int rounds, Evaluate evaluate) {
+    auto start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) evaluate();
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / (static_cast<double>(expressionCount) * rounds);
+}
+
+// Function to compare parse-and-evaluate, evalPostfix, compiled bytecode and the fused evaluator on the same expressions.
+void runBytecodeBenchmark(const BooleanDefinitions& definitions) {
+    const size_t expressionCount = 2000;  // Number of distinct expressions in the corpus.
+    const int rounds = 50;                // Number of times each expression is re-evaluated.
+    GeneratorOptions options;             // Literal-only expressions of moderate size.
+    options.operands = 24;
+    options.maxDepth = 8;
+    ExpressionGenerator generator(options, definitions, 12345);  // Fixed seed so runs are comparable.
+
+    vector<string> expressions;           // Infix expressions as a user would type them.
+    vector<string> postfixes;             // Expressions parsed once by shuntingYard.
+    vector<CompiledExpression> programs;  // Expressions compiled once into bytecode.
+    for (size_t i = 0; i < expressionCount; ++i) {
+        expressions.push_back(generator.next());
+        postfixes.push_back(shuntingYard(expressions.back(), definitions));
+        programs.push_back(compilePostfix(postfixes.back(), definitions));
+    }
+
+    vector<uint8_t> stack;                // Evaluation stack shared by every program run.
+    size_t sink = 0;                      // Accumulated results so the work cannot be optimized away.
+
+    double parseAndEval = timePerExpression(expressionCount, rounds, [&]() {
+        for (const string& expression : expressions) sink += evalPostfix(shuntingYard(expression, definitions), definitions);
+    });
+    double postfixOnly = timePerExpression(expressionCount, rounds, [&]() {
+        for (const string& postfix : postfixes) sink += evalPostfix(postfix, definitions);
+    });
+    double bytecode = timePerExpression(expressionCount, rounds, [&]() {
+        for (const CompiledExpression& program : programs) sink += runProgram(program, stack);
+    });
+    EvalScratch scratch;                  // Buffers reused by every fused evaluation.
+    double fused = timePerExpression(expressionCount, rounds, [&]() {
+        for (const string& expression : expressions) sink += evaluateExpression(expression, scratch, definitions);
+    });
+
+    cout << fixed << setprecision(1)
+         << "shuntingYard + evalPostfix: " << parseAndEval << " ns/expression\n"
+         << "evalPostfix (pre-parsed):   " << postfixOnly << " ns/expression\n"
+         << "runProgram (pre-compiled):  " << bytecode << " ns/expression\n"
+         << "evaluateExpression (fused): " << fused << " ns/expression\n"
+         << setprecision(2)
+         << "Speedup over evalPostfix:   " << postfixOnly / bytecode << "x\n"
+         << "Fused speedup over shuntingYard + evalPostfix: " << parseAndEval / fused << "x\n"
+         << "(checksum " << sink << ")" << endl;
+}
+
+// Function to compare the bytecode interpreter with the simplified, short-circuiting graph on large expressions.
+void runDagBenchmark(const BooleanDefinitions& definitions) {
+    const size_t expressionCount = 20;    // Number of large expressions in the corpus.
+    const int assignments = 256;          // Number of variable assignments each expression is evaluated for.
+    GeneratorOptions options;             // Large expressions over few variables, so subexpressions repeat.
+    options.operands = 512;
+    options.maxDepth = 16;
+    options.variables = "ABCDEGH";
+    options.variableChance = 0.8;
+    ExpressionGenerator generator(options, definitions, 54321);  // Fixed seed so runs are comparable.
+
+    vector<CompiledExpression> programs;  // Expressions compiled once into bytecode.
+    vector<ExpressionDag> dags;           // The same expressions as simplified graphs.
+    size_t sourceNodes = 0, dagNodes = 0;
+    for (size_t i = 0; i < expressionCount; ++i) {
+        programs.push_back(compileExpression(generator.next(), definitions, true));
+        dags.emplace_back(programs.back());
+        sourceNodes += dags.back().sourceNodes();
+        dagNodes += dags.back().dagNodes();
+    }
+
+    vector<uint8_t> stack;                // Evaluation stack shared by every program run.
+    size_t sink = 0;                      // Accumulated results so the work cannot be optimized away.
+    size_t visited = 0;                   // Nodes the graph evaluator actually visited.
+
+    double bytecode = timePerExpression(expressionCount, assignments, [&, assignment = uint64_t(0)]() mutable {
+        for (const CompiledExpression& program : programs) sink += runProgram(program, stack, assignment);
+        ++assignment;
+    });
+    double dag = timePerExpression(expressionCount, assignments, [&, assignment = uint64_t(0)]() mutable {
+        for (ExpressionDag& graph : dags) {
+            sink += graph.evaluate(assignment);
+            visited += graph.visitedNodes();
+        }
+        ++assignment;
+    });
+
+    cout << fixed << setprecision(1)
+         << "Large expressions: " << sourceNodes / expressionCount << " nodes on average, "
+         << dagNodes / expressionCount << " after simplification and sharing ("
+         << (sourceNodes - dagNodes) / expressionCount << " eliminated)\n"
+         << "runProgram (pre-compiled):  " << bytecode << " ns/expression\n"
+         << "ExpressionDag::evaluate:    " << dag << " ns/expression, "
+         << static_cast<double>(visited) / (expressionCount * assignments) << " nodes visited on average\n"
+         << setprecision(2)
+         << "Speedup over runProgram:    " << bytecode / dag << "x\n"
+         << "(checksum " << sink << ")" << endl;
+}
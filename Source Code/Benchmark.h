@@ -0,0 +1,9 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+void runBytecodeBenchmark(const BooleanDefinitions& definitions);  // Compare the evaluators on small expressions.
+void runDagBenchmark(const BooleanDefinitions& definitions);       // Compare bytecode with the graph on large ones.
+
+#endif // BENCHMARK_H
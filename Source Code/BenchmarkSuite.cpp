@@ -0,0 +1,529 @@
+/*
+ * BenchmarkSuite.cpp : Standalone benchmark that times the parse and evaluate stages on seeded corpora.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <fstream>                // Include the library for writing output files.
+#include <sstream>                // Include the library for splitting option values.
+#include <iomanip>                // Include the library for manipulating output formatting.
+#include <chrono>                 // Include the library for timing.
+#include <thread>                 // Include the library for launching worker threads.
+#include <atomic>                 // Include the library for lock-free counters and flags.
+#include <algorithm>              // Include the library for min and max.
+#include <cstdlib>                // Include the library for malloc and free.
+#include <cstdio>                 // Include the library for formatting escapes.
+#include <cctype>                 // Include the library for character classification functions.
+#include <new>                    // Include the library for replacing the allocation functions.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <memory>                 // Include the library for owning pointers.
+#include <random>                 // Include the library for seeded random numbers.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
+#include "PostfixEval.h"          // Include the user-defined header file that declares the postfix evaluator.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+#include "Jit.h"                  // Include the user-defined header file that declares the native backend.
+#include "StaticExpression.h"     // Include the user-defined header file that defines compile-time expressions.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Allocation counters of the calling thread, updated by the replacement operator new below.
+static thread_local uint64_t allocatedBytes = 0;
+static thread_local uint64_t allocationCount = 0;
+
+// Replacement allocation functions that count every heap allocation made by this program.
+void* operator new(size_t size) {
+    allocatedBytes += size;
+    ++allocationCount;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+enum BenchStage {                 // Define an enumeration of the stages that are timed separately.
+    STAGE_PARSE,                  // Enumerator for shuntingYard alone.
+    STAGE_EVALUATE,               // Enumerator for evalPostfix on parsed expressions.
+    STAGE_FUSED,                  // Enumerator for the single-pass evaluateExpression.
+    STAGE_BYTECODE,               // Enumerator for runProgram on compiled expressions.
+    STAGE_SLICED,                 // Enumerator for runSlicedProgram on 64 rows at once.
+    STAGE_JIT,                    // Enumerator for the native code of JitExpression on 64 rows at once.
+    STAGE_STATIC                  // Enumerator for StaticExpression, parsed at compile time (policy corpus only).
+};
+static const char* const stageNames[] = {"parse", "evaluate", "fused", "bytecode", "sliced", "jit", "static"};
+// Rows of a truth table one call of each stage covers; parse counts the one row its output is evaluated for.
+static const unsigned stageRows[] = {1, 1, 1, 1, 64, 64, 1};
+
+// Policy fixed in the source and parsed while this file compiles, timed by the static stage.
+static constexpr char benchmarkPolicyText[] = "(A & B) | !(C $ D) @ (E | !G) & (H @ !J)";
+STATIC_BOOLEAN_EXPRESSION(BenchmarkPolicy, benchmarkPolicyText);
+
+struct Corpus {                   // Define a structure for one set of expressions and their prepared forms.
+    string name;                  // Member holding the name used in the report.
+    vector<string> expressions;   // Member holding the infix text.
+    vector<string> postfixes;     // Member holding the output of shuntingYard.
+    vector<CompiledExpression> programs;  // Member holding the compiled bytecode.
+    vector<unique_ptr<JitExpression>> jits;  // Member holding the bytecode translated to native code.
+    double meanLength = 0;        // Member holding the average length in characters.
+    double meanDepth = 0;         // Member holding the average parenthesis nesting.
+    size_t maxDepth = 0;          // Member holding the deepest parenthesis nesting.
+    size_t maxProgramDepth = 0;   // Member holding the largest stack depth of any compiled expression.
+    vector<uint64_t> expected;    // Member holding evalPostfix's result for each expression, as a word of rows.
+    uint64_t trueRows = 0;        // Member holding the number of true rows in expected.
+    uint64_t stageTrueRows[STAGE_STATIC + 1] = {};  // Member holding the true rows each stage computed when checked.
+    uint64_t variableWords[64] = {};  // Member holding each variable's value in the 64 rows of the sliced stages.
+    vector<uint64_t> assignments; // Member holding the row of variableWords the scalar stages evaluate, per expression.
+    bool variables = false;       // Member marking a corpus whose expressions read variables.
+    bool policy = false;          // Member marking the policy corpus, whose expression i is assignment i.
+};
+
+struct StageResult {              // Define a structure for one timed run of a stage.
+    double seconds = 0;           // Member holding the wall-clock time.
+    uint64_t expressions = 0;     // Member holding the number of expressions processed.
+    uint64_t bytes = 0;           // Member holding the bytes allocated by every worker.
+    uint64_t allocations = 0;     // Member holding the allocations made by every worker.
+};
+
+static atomic<uint64_t> checksum{0};  // Accumulated results so the work cannot be optimized away.
+
+struct StageWorker {              // Define a structure for the buffers one worker reuses across expressions.
+    EvalScratch scratch;          // Member holding the fused evaluator's buffers.
+    vector<uint8_t> stack;        // Member holding the bytecode interpreter's stack.
+    vector<uint64_t> slicedStack; // Member holding the sliced interpreter's stack.
+
+    explicit StageWorker(const Corpus& corpus) : slicedStack(corpus.maxProgramDepth) {}
+};
+
+// Function to spread a single result over every row of a word, the form the sliced stages return.
+static inline uint64_t rowWord(bool value) {
+    return value ? ~0ULL : 0;
+}
+
+// Function to return the row of the variable words the scalar stages evaluate expression i on.
+static inline unsigned scalarRow(size_t i) {
+    return static_cast<unsigned>(i % 64);
+}
+
+// Function to check whether a stage can run on a corpus: the static stage only knows the policy, and evalPostfix
+// and the fused evaluator read literals only.
+static bool stageRuns(BenchStage stage, const Corpus& corpus) {
+    if (stage == STAGE_STATIC) return corpus.policy;
+    if (stage == STAGE_EVALUATE || stage == STAGE_FUSED) return !corpus.variables;
+    return true;
+}
+
+// Function to run one stage on one expression. Every stage but parse returns its result as a word of rows, so
+// the stages can be checked against each other; parse returns the length of its output.
+static inline uint64_t runExpression(BenchStage stage, const Corpus& corpus, size_t i, StageWorker& worker,
+                                     const BooleanDefinitions& definitions) {
+    switch (stage) {
+        case STAGE_PARSE:    return shuntingYard(corpus.expressions[i], definitions, corpus.variables).size();
+        case STAGE_EVALUATE: return rowWord(evalPostfix(corpus.postfixes[i], definitions));
+        case STAGE_FUSED:    return rowWord(evaluateExpression(corpus.expressions[i], worker.scratch, definitions));
+        case STAGE_BYTECODE: return rowWord(runProgram(corpus.programs[i], worker.stack, corpus.assignments[i]));
+        case STAGE_SLICED:
+            return runSlicedProgram(corpus.programs[i].code.data(), corpus.programs[i].code.size(),
+                                    worker.slicedStack.data(), corpus.variableWords);
+        case STAGE_JIT: {         // Call the machine code directly; the interpreter fallback is not shared.
+            const JitExpression& jit = *corpus.jits[i];
+            return jit.isNative() ? jit.nativeFunction()(corpus.variableWords)
+                                  : runSlicedProgram(corpus.programs[i].code.data(), corpus.programs[i].code.size(),
+                                                     worker.slicedStack.data(), corpus.variableWords);
+        }
+        case STAGE_STATIC:   return rowWord(BenchmarkPolicy::evaluate(i));
+    }
+    return 0;
+}
+
+// Function to check, untimed, that a stage computes evalPostfix's result for every expression of a corpus, so
+// stages that disagree are never reported side by side. Parse must reproduce the postfix the others start from.
+// Returns the number of true rows the stage computed.
+static uint64_t verifyStage(BenchStage stage, const Corpus& corpus, const BooleanDefinitions& definitions) {
+    StageWorker worker(corpus);
+    uint64_t trueRows = 0;
+    for (size_t i = 0; i < corpus.expressions.size(); ++i) {
+        uint64_t expected = corpus.expected[i];  // The scalar stages compute a single row.
+        if (stageRows[stage] == 1) expected = rowWord((expected >> scalarRow(i)) & 1);
+        uint64_t word;
+        if (stage == STAGE_PARSE) {
+            string postfix = shuntingYard(corpus.expressions[i], definitions, corpus.variables);
+            word = (postfix == corpus.postfixes[i]) ? expected : ~expected;
+        } else {
+            word = runExpression(stage, corpus, i, worker, definitions);
+        }
+        if (word != expected) {
+            throw logic_error(string("Stage ") + stageNames[stage] + " disagrees with evalPostfix on " + corpus.name +
+                              " expression " + to_string(i) + ": " + corpus.expressions[i]);
+        }
+        trueRows += (stageRows[stage] == 1) ? (word & 1) : __builtin_popcountll(word);
+    }
+    return trueRows;
+}
+
+// Function to gather one row of a corpus's variable words into an assignment, bit v holding variable v.
+static uint64_t rowAssignment(const Corpus& corpus, size_t variableCount, unsigned row) {
+    uint64_t assignment = 0;
+    for (size_t v = 0; v < variableCount; ++v) assignment |= ((corpus.variableWords[v] >> row) & 1) << v;
+    return assignment;
+}
+
+// Function to evaluate a postfix expression with its variables written in as literals, the reference every
+// stage is checked against.
+static bool evaluateAssignment(string postfix, const string& variables, uint64_t assignment,
+                               const BooleanDefinitions& definitions) {
+    for (char& c : postfix) {
+        size_t v = variables.find(c);
+        if (v != string::npos) c = ((assignment >> v) & 1) ? definitions.trueDef : definitions.falseDef;
+    }
+    return evalPostfix(postfix, definitions);
+}
+
+// Function to prepare the parsed and compiled forms of a corpus's expressions.
+static void prepareCorpus(Corpus& corpus, const BooleanDefinitions& definitions) {
+    size_t count = corpus.expressions.size();
+    size_t totalLength = 0, totalDepth = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const string& expression = corpus.expressions[i];
+        corpus.postfixes.push_back(shuntingYard(expression, definitions, corpus.variables));
+        corpus.programs.push_back(compilePostfix(corpus.postfixes[i], definitions));
+        corpus.jits.emplace_back(new JitExpression(corpus.programs[i]));
+        size_t depth = expressionDepth(expression);
+        totalLength += expression.size();
+        totalDepth += depth;
+        corpus.maxDepth = max(corpus.maxDepth, depth);
+        corpus.maxProgramDepth = max(corpus.maxProgramDepth, corpus.programs[i].maxDepth);
+        const string& variables = corpus.programs[i].variables;
+        uint64_t expected = 0;    // Every row of the variable words, so the sliced stages are checked row by row.
+        for (unsigned row = 0; row < 64; ++row) {
+            if (evaluateAssignment(corpus.postfixes[i], variables, rowAssignment(corpus, variables.size(), row),
+                                   definitions)) {
+                expected |= 1ULL << row;
+            }
+        }
+        corpus.expected.push_back(expected);
+        corpus.assignments.push_back(rowAssignment(corpus, variables.size(), scalarRow(i)));
+        corpus.trueRows += __builtin_popcountll(corpus.expected[i]);
+    }
+    corpus.meanLength = static_cast<double>(totalLength) / max<size_t>(1, count);
+    corpus.meanDepth = static_cast<double>(totalDepth) / max<size_t>(1, count);
+}
+
+// Function to generate a corpus and prepare its parsed and compiled forms.
+static Corpus buildCorpus(const string& name, const GeneratorOptions& options, size_t count, uint64_t seed,
+                          const BooleanDefinitions& definitions) {
+    Corpus corpus;
+    corpus.name = name;
+    if (!options.variables.empty() && options.variableChance > 0) {  // Random rows, so no row is favoured.
+        corpus.variables = true;
+        mt19937_64 rng(~seed);
+        for (uint64_t& word : corpus.variableWords) word = rng();
+    }
+    ExpressionGenerator generator(options, definitions, seed);
+    for (size_t i = 0; i < count; ++i) corpus.expressions.push_back(generator.next());
+    prepareCorpus(corpus, definitions);
+    return corpus;
+}
+
+// Function to build the policy corpus: the fixed policy with every assignment written in as literals, so
+// expression i has the value BenchmarkPolicy::evaluate(i) and each stage computes the same results.
+static Corpus buildPolicyCorpus(const BooleanDefinitions& definitions) {
+    Corpus corpus;
+    corpus.name = "policy";
+    corpus.policy = true;
+    for (uint64_t assignment = 0; assignment < (1ULL << BenchmarkPolicy::variableCount); ++assignment) {
+        string expression = benchmarkPolicyText;
+        for (char& c : expression) {
+            if (!isalpha(static_cast<unsigned char>(c))) continue;
+            c = ((assignment >> BenchmarkPolicy::variable(c)) & 1) ? definitions.trueDef : definitions.falseDef;
+        }
+        corpus.expressions.push_back(expression);
+    }
+    prepareCorpus(corpus, definitions);
+    for (uint64_t i = 0; i < corpus.postfixes.size(); ++i) {  // The static stage is only comparable if this holds.
+        if (evalPostfix(corpus.postfixes[i], definitions) != BenchmarkPolicy::evaluate(i)) {
+            throw logic_error("Policy corpus expression " + to_string(i) + " does not match BenchmarkPolicy");
+        }
+    }
+    return corpus;
+}
+
+// Function to build the named corpora: the fixed ones and the random one, each from its own seed so adding one
+// does not change another.
+static vector<Corpus> buildCorpora(const string& corpusNames, uint64_t seed, const GeneratorOptions& randomOptions,
+                                   size_t randomCount, const BooleanDefinitions& definitions) {
+    vector<Corpus> corpora;
+    stringstream names(corpusNames);
+    string name;
+    while (getline(names, name, ',')) {
+        GeneratorOptions options;
+        size_t count = 2000;
+        uint64_t corpusSeed = seed;
+        if (name == "short") {           // A handful of operands, as typed into the calculator.
+            options.operands = 3;
+            options.maxDepth = 1;
+        } else if (name == "long") {     // Hundreds of operands with moderate nesting.
+            options.operands = 256;
+            options.maxDepth = 6;
+            count = 200;
+            corpusSeed += 1;
+        } else if (name == "deep") {     // Every operator nests one level deeper than the last.
+            options.operands = 128;
+            options.maxDepth = 127;
+            options.parenChance = 1.0;
+            options.chainChance = 1.0;
+            count = 200;
+            corpusSeed += 2;
+        } else if (name == "variables") {  // Mostly variables, loaded from random rows.
+            options.operands = 16;
+            options.variableChance = 0.75;
+            for (char c = 'A'; c <= 'Z' && options.variables.size() < 8; ++c) {
+                if (c != definitions.trueDef && c != definitions.falseDef) options.variables += c;
+            }
+            corpusSeed += 4;
+        } else if (name == "policy") {   // A fixed rule over eight variables, one expression per assignment.
+            corpora.push_back(buildPolicyCorpus(definitions));
+            continue;
+        } else if (name == "random") {   // Shaped by the command line.
+            options = randomOptions;
+            count = randomCount;
+            corpusSeed += 3;
+        } else {
+            throw invalid_argument("Unknown corpus: " + name);
+        }
+        corpora.push_back(buildCorpus(name, options, count, corpusSeed, definitions));
+    }
+    return corpora;
+}
+
+// Function to run one stage over the corpus on the given number of threads, each taking every n-th expression.
+static StageResult runStage(BenchStage stage, const Corpus& corpus, unsigned threadCount, int rounds,
+                            const BooleanDefinitions& definitions) {
+    atomic<unsigned> ready{0};    // Number of workers waiting at the start line.
+    atomic<bool> go{false};       // Flag that starts every worker at once.
+    atomic<uint64_t> bytes{0}, allocations{0};
+    size_t count = corpus.expressions.size();
+
+    auto worker = [&](unsigned id) {
+        StageWorker buffers(corpus);  // Buffers owned by this worker.
+        uint64_t sink = 0;
+        ++ready;
+        while (!go.load(memory_order_acquire)) this_thread::yield();
+        uint64_t startBytes = allocatedBytes, startCount = allocationCount;
+        for (int round = 0; round < rounds; ++round) {
+            for (size_t i = id; i < count; i += threadCount) {
+                sink += runExpression(stage, corpus, i, buffers, definitions);
+            }
+        }
+        bytes += allocatedBytes - startBytes;
+        allocations += allocationCount - startCount;
+        checksum += sink;
+    };
+
+    vector<thread> workers;
+    for (unsigned i = 0; i < threadCount; ++i) workers.emplace_back(worker, i);
+    while (ready.load() < threadCount) this_thread::yield();
+    auto start = chrono::steady_clock::now();
+    go.store(true, memory_order_release);
+    for (thread& t : workers) t.join();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    StageResult result;
+    result.seconds = elapsed.count();
+    result.expressions = static_cast<uint64_t>(count) * rounds;
+    result.bytes = bytes;
+    result.allocations = allocations;
+    return result;
+}
+
+// Function to quote text as a JSON string, escaping quotes, backslashes and control characters.
+static string jsonString(const string& text) {
+    string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+            quoted += escape;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + '"';
+}
+
+// Function to parse a comma-separated list of numbers.
+static vector<double> parseList(const string& text) {
+    vector<double> values;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) values.push_back(stod(item));
+    if (values.empty()) throw invalid_argument("Empty list: " + text);
+    return values;
+}
+
+// Function to print the command line usage of the benchmark.
+static void printBenchUsage(const char* program) {
+    cerr << "Usage: " << program << " [--format json|csv] [--out <file|->] [--seed <n>] [--threads <n,n,...>]\n"
+         << "       [--min-time <ms>] [--corpus short,long,deep,random,variables,policy] [--count <n>] [--operands <n>] [--depth <n>]\n"
+         << "       [--parens <p>] [--chain <p>] [--not <p>] [--mix <and,or,nand,xor>] [--true <char>] [--false <char>]\n"
+         << "The random corpus is shaped by --count, --operands, --depth, --parens, --chain, --not and --mix." << endl;
+}
+
+// Main function of the benchmark, timing every stage of every corpus at every thread count.
+int main(int argc, char* argv[]) {
+    string format = "json";       // Output format.
+    string outputPath = "-";      // Path of the report, or "-" for standard output.
+    uint64_t seed = 12345;        // Seed every corpus is derived from.
+    vector<unsigned> threadCounts;  // Thread counts to measure.
+    double minMilliseconds = 200; // Shortest single-thread run of a stage, used to pick the round count.
+    string corpusNames = "short,long,deep,random,variables,policy";  // Corpora to run.
+    size_t randomCount = 1000;    // Number of expressions in the random corpus.
+    GeneratorOptions randomOptions;  // Shape of the random corpus.
+    randomOptions.operands = 16;
+    BooleanDefinitions definitions;  // Characters standing for true and false.
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            string option = argv[i];
+            if (i + 1 >= argc) throw invalid_argument("Missing value for " + option);
+            string value = argv[++i];
+            if (option == "--format" && (value == "json" || value == "csv")) format = value;
+            else if (option == "--out") outputPath = value;
+            else if (option == "--seed") seed = stoull(value);
+            else if (option == "--threads") {
+                for (double n : parseList(value)) threadCounts.push_back(max(1u, static_cast<unsigned>(n)));
+            }
+            else if (option == "--min-time") minMilliseconds = stod(value);
+            else if (option == "--corpus") corpusNames = value;
+            else if (option == "--count") randomCount = stoul(value);
+            else if (option == "--operands") randomOptions.operands = stoul(value);
+            else if (option == "--depth") randomOptions.maxDepth = stoul(value);
+            else if (option == "--parens") randomOptions.parenChance = stod(value);
+            else if (option == "--chain") randomOptions.chainChance = stod(value);
+            else if (option == "--not") randomOptions.notChance = stod(value);
+            else if (option == "--mix") {
+                vector<double> weights = parseList(value);
+                if (weights.size() != 4) throw invalid_argument("--mix takes four weights");
+                copy(weights.begin(), weights.end(), randomOptions.operatorWeights);
+            }
+            else if (option == "--true" && value.size() == 1) definitions.trueDef = value[0];
+            else if (option == "--false" && value.size() == 1) definitions.falseDef = value[0];
+            else throw invalid_argument("Unknown option: " + option);
+        }
+        if (definitions.trueDef == definitions.falseDef) throw invalid_argument("True and false must differ");
+        if (!isalpha(static_cast<unsigned char>(definitions.trueDef)) || !isalpha(static_cast<unsigned char>(definitions.falseDef))) {
+            throw invalid_argument("True and false must be letters");  // The parser only reads letters as operands.
+        }
+    } catch (exception& e) {      // Reject malformed options.
+        cerr << "Error: " << e.what() << endl;
+        printBenchUsage(argv[0]);
+        return 1;
+    }
+
+    unsigned hardwareThreads = max(1u, thread::hardware_concurrency());
+    if (threadCounts.empty()) {   // Default to powers of two up to the core count.
+        for (unsigned n = 1; n < hardwareThreads; n *= 2) threadCounts.push_back(n);
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    vector<Corpus> corpora;
+    try {
+        corpora = buildCorpora(corpusNames, seed, randomOptions, randomCount, definitions);
+    } catch (invalid_argument& e) {  // Reject unknown corpus names.
+        cerr << "Error: " << e.what() << endl;
+        printBenchUsage(argv[0]);
+        return 1;
+    } catch (exception& e) {      // A corpus that does not hold what it promises must not be timed.
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    // Check every stage before timing any, so a stage computing something else stops the run without a report.
+    try {
+        for (Corpus& corpus : corpora) {
+            for (int s = STAGE_PARSE; s <= STAGE_STATIC; ++s) {
+                if (!stageRuns(static_cast<BenchStage>(s), corpus)) continue;
+                corpus.stageTrueRows[s] = verifyStage(static_cast<BenchStage>(s), corpus, definitions);
+            }
+        }
+    } catch (exception& e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    ofstream file;
+    if (outputPath != "-") {
+        file.open(outputPath);
+        if (!file) {
+            cerr << "Error: Unable to open output file: " << outputPath << endl;
+            return 1;
+        }
+    }
+    ostream& out = (outputPath == "-") ? cout : file;
+    out << setprecision(6);
+
+    if (format == "json") {
+        out << "{\n  \"seed\": " << seed << ",\n  \"hardware_threads\": " << hardwareThreads
+            << ",\n  \"true\": " << jsonString(string(1, definitions.trueDef))
+            << ",\n  \"false\": " << jsonString(string(1, definitions.falseDef)) << ",\n  \"corpora\": [";
+        for (size_t i = 0; i < corpora.size(); ++i) {
+            out << (i ? "," : "") << "\n    {\"name\": " << jsonString(corpora[i].name) << ", \"expressions\": "
+                << corpora[i].expressions.size() << ", \"mean_length\": " << corpora[i].meanLength
+                << ", \"mean_depth\": " << corpora[i].meanDepth << ", \"max_depth\": " << corpora[i].maxDepth
+                << ", \"variables\": " << (corpora[i].variables ? "true" : "false")
+                << ", \"true_rows\": " << corpora[i].trueRows << "}";
+        }
+        out << "\n  ],\n  \"results\": [";
+    } else {
+        out << "corpus,stage,threads,rounds,expressions,ns_per_expression,expressions_per_second,rows_per_second,"
+               "bytes_per_expression,allocations_per_expression,speedup,true_rows\n";
+    }
+
+    bool first = true;
+    for (const Corpus& corpus : corpora) {
+        for (int s = STAGE_PARSE; s <= STAGE_STATIC; ++s) {
+            BenchStage stage = static_cast<BenchStage>(s);
+            if (!stageRuns(stage, corpus)) continue;
+            // Pick a round count from one untimed pass so every measurement lasts at least the minimum time.
+            StageResult trial = runStage(stage, corpus, 1, 1, definitions);
+            int rounds = static_cast<int>(min(1e6, max(1.0, minMilliseconds / 1000 / max(trial.seconds, 1e-9))));
+            double baseline = 0;  // Expressions per second on one thread.
+            for (unsigned threads : threadCounts) {
+                StageResult result = runStage(stage, corpus, threads, rounds, definitions);
+                double perSecond = result.expressions / result.seconds;
+                double rowsPerSecond = perSecond * stageRows[stage];  // A sliced call covers 64 rows.
+                if (baseline == 0) baseline = perSecond;
+                double ns = result.seconds * 1e9 / result.expressions;
+                double bytes = static_cast<double>(result.bytes) / result.expressions;
+                double allocations = static_cast<double>(result.allocations) / result.expressions;
+                if (format == "json") {
+                    out << (first ? "" : ",") << "\n    {\"corpus\": " << jsonString(corpus.name) << ", \"stage\": \""
+                        << stageNames[stage] << "\", \"threads\": " << threads << ", \"rounds\": " << rounds
+                        << ", \"expressions\": " << result.expressions << ", \"ns_per_expression\": " << ns
+                        << ", \"expressions_per_second\": " << perSecond << ", \"rows_per_second\": " << rowsPerSecond
+                        << ", \"bytes_per_expression\": " << bytes
+                        << ", \"allocations_per_expression\": " << allocations
+                        << ", \"speedup\": " << perSecond / baseline << ", \"true_rows\": " << corpus.stageTrueRows[stage] << "}";
+                } else {
+                    out << corpus.name << ',' << stageNames[stage] << ',' << threads << ',' << rounds << ','
+                        << result.expressions << ',' << ns << ',' << perSecond << ',' << rowsPerSecond << ',' << bytes << ','
+                        << allocations << ',' << perSecond / baseline << ',' << corpus.stageTrueRows[stage] << '\n';
+                }
+                first = false;
+                out.flush();
+            }
+        }
+    }
+    if (format == "json") out << "\n  ],\n  \"checksum\": " << checksum.load() << "\n}\n";
+    out.flush();
+    return out ? 0 : 1;
+}
@@ -11,21 +11,21 @@
  *   - Jack Pigott
  *
  * Creation Date: May 2, 2024
- * Modification Date: May 2, 2024
+ * Modification Date: October 17, 2026
  * 
  */
 
 #include <iostream>  // Include the library for input and output streaming.
+#include <limits>    // Include the library for error handling
 #include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
 
 using namespace std;              // Use the standard namespace to avoid prefixing with std::.
 
-char trueDef = 'T';          // Default definition for true.
-char falseDef = 'F';         // Default definition for false.
-
 // Function to prompt the user to define true and false
-void defineTrueFalse() {
+void defineTrueFalse(BooleanDefinitions& definitions) {
     char trueInput, falseInput;
+    char& trueDef = definitions.trueDef;     // Definition for true being updated.
+    char& falseDef = definitions.falseDef;   // Definition for false being updated.
 
     // Loop until the user enters valid single characters for true and false representations
     do {
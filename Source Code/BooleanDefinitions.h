@@ -1,7 +1,11 @@
 #ifndef BOOLEANDEFINITIONS_H
 #define BOOLEANDEFINITIONS_H
 
-extern char trueDef;
-extern char falseDef;
+struct BooleanDefinitions {       // Define a structure holding the characters that stand for true and false.
+    char trueDef = 'T';           // Default definition for true.
+    char falseDef = 'F';          // Default definition for false.
+};
+
+void defineTrueFalse(BooleanDefinitions& definitions);  // Prompt the user to define true and false.
 
 #endif // BOOLEANDEFINITIONS_H
@@ -0,0 +1,96 @@
+/*
+ * Bytecode.cpp : Compiles postfix expressions into flat bytecode programs and runs them.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cctype>                 // Include the library for character classification functions.
+#include <algorithm>              // Include the library for sorting.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
+#include "Bytecode.h"             // Include the user-defined header file that declares the bytecode format.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to translate an operator symbol into its opcode.
+Opcode operatorOpcode(char c) {
+    switch (c) {
+        case '&': return OP_AND;  // AND operation.
+        case '|': return OP_OR;   // OR operation.
+        case '@': return OP_NAND; // NAND operation.
+        case '$': return OP_XOR;  // XOR operation.
+        case '!': return OP_NOT;  // NOT operation.
+        default: throw invalid_argument("Unrecognized operator symbol: " + string(1, c));
+    }
+}
+
+// Function to compile a postfix expression into bytecode, computing the stack depth it needs.
+CompiledExpression compilePostfix(const string& postfix, const BooleanDefinitions& definitions) {
+    CompiledExpression program;   // Program being built.
+    program.code.reserve(postfix.size());
+    size_t depth = 0;             // Stack depth after the current instruction.
+
+    // Collect the distinct variable names so each one gets a stable index.
+    for (char c : postfix) {
+        if (isalpha(c) && c != definitions.trueDef && c != definitions.falseDef && program.variables.find(c) == string::npos) {
+            program.variables += c;
+        }
+    }
+    sort(program.variables.begin(), program.variables.end());
+
+    // Iterate over each character in the postfix expression.
+    for (char c : postfix) {
+        if (c == definitions.trueDef || c == definitions.falseDef) {  // Literals push one value.
+            program.code.push_back(c == definitions.trueDef ? OP_PUSH_TRUE : OP_PUSH_FALSE);
+            ++depth;
+            if (depth > program.maxDepth) program.maxDepth = depth;
+        } else if (isalpha(c)) {              // Variables push the value of their input.
+            program.code.push_back(OP_LOAD_VAR);
+            program.code.push_back(static_cast<uint8_t>(program.variables.find(c)));
+            ++depth;
+            if (depth > program.maxDepth) program.maxDepth = depth;
+        } else if (isOperator(c)) {           // Operators consume their operands and push one result.
+            if (c == '!') {
+                if (depth < 1) throw runtime_error("Missing operand for NOT operation");
+            } else {
+                if (depth < 2) throw runtime_error("Missing operand for binary operator");
+                --depth;
+            }
+            program.code.push_back(operatorOpcode(c));
+        }
+    }
+    if (depth == 0) throw runtime_error("No operands or operators present");  // Nothing would be left to return.
+    return program;
+}
+
+// Function to parse an infix expression, optionally with variables, and compile it into bytecode.
+CompiledExpression compileExpression(const string& expression, const BooleanDefinitions& definitions, bool allowVariables) {
+    return compilePostfix(shuntingYard(expression, definitions, allowVariables), definitions);  // Convert to postfix, then to opcodes.
+}
+
+// Function to run bytecode against a caller-provided stack holding at least the program's maximum depth.
+// Bit i of the assignment holds the value of variable i.
+bool runProgram(const uint8_t* code, size_t length, uint8_t* stack, uint64_t assignment) {
+    size_t top = 0;               // Number of values currently on the stack.
+    for (size_t i = 0; i < length; ++i) {
+        switch (code[i]) {
+            case OP_PUSH_TRUE:  stack[top++] = 1; break;                          // Push true.
+            case OP_PUSH_FALSE: stack[top++] = 0; break;                          // Push false.
+            case OP_AND:  --top; stack[top - 1] = stack[top - 1] & stack[top]; break;        // AND operation.
+            case OP_OR:   --top; stack[top - 1] = stack[top - 1] | stack[top]; break;        // OR operation.
+            case OP_NAND: --top; stack[top - 1] = !(stack[top - 1] & stack[top]); break;     // NAND operation.
+            case OP_XOR:  --top; stack[top - 1] = stack[top - 1] ^ stack[top]; break;        // XOR operation.
+            case OP_NOT:  stack[top - 1] = !stack[top - 1]; break;                // NOT operation.
+            case OP_LOAD_VAR: stack[top++] = (assignment >> code[++i]) & 1; break;  // Push a variable.
+        }
+    }
+    return stack[top - 1];        // Return the value on top of the stack.
+}
+
+// Function to run a compiled expression, growing the reusable stack only when it is too small.
+bool runProgram(const CompiledExpression& program, vector<uint8_t>& stack, uint64_t assignment) {
+    if (stack.size() < program.maxDepth) stack.resize(program.maxDepth);
+    return runProgram(program.code.data(), program.code.size(), stack.data(), assignment);
+}
@@ -0,0 +1,42 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+enum Opcode : uint8_t {           // Define an enumeration of the bytecode instructions.
+    OP_PUSH_TRUE,                 // Push the value true.
+    OP_PUSH_FALSE,                // Push the value false.
+    OP_AND,                       // Replace the top two values with their AND.
+    OP_OR,                        // Replace the top two values with their OR.
+    OP_NAND,                      // Replace the top two values with their NAND.
+    OP_XOR,                       // Replace the top two values with their XOR.
+    OP_NOT,                       // Replace the top value with its negation.
+    OP_LOAD_VAR                   // Push the variable whose index is stored in the next byte.
+};
+
+struct CompiledExpression {       // Define a structure to hold a compiled, reusable expression.
+    std::vector<uint8_t> code;    // Member to store the opcodes in evaluation order.
+    size_t maxDepth = 0;          // Member to store the largest stack depth the program reaches.
+    std::string variables;        // Member to store the variable names, sorted, indexed by OP_LOAD_VAR.
+};
+
+Opcode operatorOpcode(char c);    // Translate an operator symbol into its opcode.
+
+// Compile a postfix expression into bytecode, computing the stack depth it needs.
+CompiledExpression compilePostfix(const std::string& postfix, const BooleanDefinitions& definitions);
+
+// Parse an infix expression, optionally with variables, and compile it into bytecode.
+CompiledExpression compileExpression(const std::string& expression, const BooleanDefinitions& definitions, bool allowVariables = false);
+
+// Run bytecode against a caller-provided stack holding at least the program's maximum depth.
+// Bit i of the assignment holds the value of variable i.
+bool runProgram(const uint8_t* code, size_t length, uint8_t* stack, uint64_t assignment = 0);
+
+// Run a compiled expression, growing the reusable stack only when it is too small.
+bool runProgram(const CompiledExpression& program, std::vector<uint8_t>& stack, uint64_t assignment = 0);
+
+#endif // BYTECODE_H
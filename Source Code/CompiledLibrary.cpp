@@ -0,0 +1,327 @@
+/*
+ * CompiledLibrary.cpp : Versioned, checksummed files of compiled expressions, loaded by memory mapping.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <fstream>                // Include the library for writing output files.
+#include <cstdio>                 // Include the library for buffered C file output.
+#include <cstring>                // Include the library for comparing and copying memory.
+#include <memory>                 // Include the library for owning pointers.
+#include <cctype>                 // Include the library for character classification functions.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "FileParse.h"            // Include the user-defined header file that defines the operators.
+#include "CompiledLibrary.h"      // Include the user-defined header file that declares the library format.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+const uint64_t FNV_OFFSET = 14695981039346656037ULL;  // Starting value of FNV-1a.
+const uint64_t FNV_PRIME = 1099511628211ULL;          // Multiplier of FNV-1a.
+
+// Function to fingerprint the operators: their symbols, precedence, associativity and opcodes, and the
+// opcode numbering, so a library is rejected by a build that would read its bytecode differently.
+uint64_t operatorSignature() {
+    uint64_t hash = FNV_OFFSET;
+    auto mix = [&](uint64_t value) { hash = (hash ^ value) * FNV_PRIME; };
+    for (char c : string("!$&@|")) {
+        mix(static_cast<uint8_t>(c));
+        mix(static_cast<uint64_t>(getPrecedence(c)));
+        mix(isLeftAssociative(c));
+        mix(operatorOpcode(c));
+    }
+    mix(OP_PUSH_TRUE);
+    mix(OP_PUSH_FALSE);
+    mix(OP_LOAD_VAR);
+    return hash;
+}
+
+const uint64_t MIX_PRIME1 = 11400714785074694791ULL;  // Multipliers of the xxHash64 round and avalanche.
+const uint64_t MIX_PRIME2 = 14029467366897019727ULL;
+const uint64_t MIX_PRIME3 = 1609587929392839161ULL;
+
+// Function to rotate a word left by a constant number of bits.
+static inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Function to checksum whole 64-bit words with xxHash64-style rounds: each word is multiplied and rotated
+// before it meets the state, so single-bit flips, swapped words and runs of zeros all change the result,
+// and a final avalanche spreads every input bit over the whole value.
+uint64_t libraryChecksum(const uint8_t* data, size_t size) {
+    uint64_t hash = MIX_PRIME3 ^ (static_cast<uint64_t>(size) * MIX_PRIME1);
+    for (size_t i = 0; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        hash ^= rotateLeft(word * MIX_PRIME2, 31) * MIX_PRIME1;
+        hash = rotateLeft(hash, 27) * MIX_PRIME1 + MIX_PRIME3;
+    }
+    hash ^= hash >> 33;
+    hash *= MIX_PRIME2;
+    hash ^= hash >> 29;
+    hash *= MIX_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// Function to check that bytecode only uses known opcodes and variables, keeps the stack within the depth
+// it records and leaves exactly one value, so it can be run without further checks.
+static bool validProgram(const uint8_t* code, size_t length, size_t variableCount, size_t maxDepth) {
+    size_t depth = 0, deepest = 0;
+    for (size_t i = 0; i < length; ++i) {
+        switch (code[i]) {
+            case OP_PUSH_TRUE:
+            case OP_PUSH_FALSE: ++depth; break;
+            case OP_LOAD_VAR:
+                if (i + 1 >= length || code[++i] >= variableCount) return false;
+                ++depth;
+                break;
+            case OP_NOT:
+                if (depth < 1) return false;
+                break;
+            case OP_AND:
+            case OP_OR:
+            case OP_NAND:
+            case OP_XOR:
+                if (depth < 2) return false;
+                --depth;
+                break;
+            default: return false;
+        }
+        if (depth > deepest) deepest = depth;
+    }
+    return depth == 1 && deepest == maxDepth;
+}
+
+// Function to check that an expression's variable names are letters, sorted and distinct, and that none is
+// the true or false character, as compilePostfix leaves them.
+static bool validVariables(const char* names, size_t variableCount, const BooleanDefinitions& definitions) {
+    for (size_t i = 0; i < variableCount; ++i) {
+        char name = names[i];
+        if (!isalpha(static_cast<unsigned char>(name)) || name == definitions.trueDef || name == definitions.falseDef) return false;
+        if (i > 0 && names[i - 1] >= name) return false;
+    }
+    return true;
+}
+
+// Constructor that maps a library and checks it completely, so evaluation can trust every entry.
+CompiledLibrary::CompiledLibrary(const string& path, const BooleanDefinitions& definitions) : input(path) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(input.data);
+    size_t size = input.size;
+    if (size < sizeof(LibraryHeader) || memcmp(data, LIBRARY_MAGIC, sizeof(LIBRARY_MAGIC)) != 0) {
+        throw runtime_error("Not a compiled expression library: " + path);
+    }
+    const LibraryHeader& header = *reinterpret_cast<const LibraryHeader*>(data);
+    if (header.byteOrder != LIBRARY_BYTE_ORDER) throw runtime_error("Library was written with another byte order: " + path);
+    if (header.version != LIBRARY_VERSION) {
+        throw runtime_error("Unsupported library version " + to_string(header.version) + ": " + path);
+    }
+    if (header.trueDef != static_cast<uint8_t>(definitions.trueDef) ||
+        header.falseDef != static_cast<uint8_t>(definitions.falseDef)) {
+        throw runtime_error("Library was built with '" + string(1, static_cast<char>(header.trueDef)) + "' for true and '" +
+                            string(1, static_cast<char>(header.falseDef)) + "' for false: " + path);
+    }
+    if (header.opcodeCount != OP_LOAD_VAR + 1 || header.operatorSignature != operatorSignature()) {
+        throw runtime_error("Library was built with different operator definitions: " + path);
+    }
+    if (header.fileSize != size || size % 8 != 0) throw runtime_error("Library is truncated: " + path);
+    if (header.checksum != libraryChecksum(data + sizeof(LibraryHeader), size - sizeof(LibraryHeader))) {
+        throw runtime_error("Library checksum mismatch: " + path);
+    }
+
+    // Locate the tables, then check every entry against them once.
+    count = static_cast<size_t>(header.expressionCount);
+    size_t entriesEnd = sizeof(LibraryHeader) + count * sizeof(LibraryEntry);
+    bool reservedClear = true;
+    for (uint8_t byte : header.reserved) reservedClear = reservedClear && byte == 0;
+    if (!reservedClear || count > size / sizeof(LibraryEntry) || header.variablesOffset != entriesEnd ||
+        header.codeOffset < header.variablesOffset || header.codeOffset > size) {
+        throw runtime_error("Library tables are corrupt: " + path);
+    }
+    entries = reinterpret_cast<const LibraryEntry*>(data + sizeof(LibraryHeader));
+    variableTable = reinterpret_cast<const char*>(data + header.variablesOffset);
+    codeTable = data + header.codeOffset;
+    uint64_t variableBytes = header.codeOffset - header.variablesOffset;
+    uint64_t codeBytes = size - header.codeOffset;
+    uint64_t variablesEnd = 0, codeEnd = 0;  // Expressions are stored back to back, in order.
+    for (size_t i = 0; i < count; ++i) {
+        const LibraryEntry& entry = entries[i];
+        bool inside = entry.variablesStart == variablesEnd && entry.variableCount <= variableBytes - variablesEnd &&
+                      entry.codeStart == codeEnd && entry.codeLength <= codeBytes - codeEnd &&
+                      entry.variableCount <= 64;
+        if (!inside || !validVariables(variableTable + entry.variablesStart, entry.variableCount, definitions) ||
+            !validProgram(codeTable + entry.codeStart, entry.codeLength, entry.variableCount, entry.maxDepth)) {
+            throw runtime_error("Library expression " + to_string(i) + " is corrupt: " + path);
+        }
+        variablesEnd += entry.variableCount;
+        codeEnd += entry.codeLength;
+        if (entry.maxDepth > largestDepth) largestDepth = entry.maxDepth;
+    }
+
+    // Nothing may follow the tables except the zero padding to a whole word.
+    if (variablesEnd != variableBytes || (header.codeOffset + codeEnd + 7) / 8 * 8 != size) {
+        throw runtime_error("Library tables are corrupt: " + path);
+    }
+    for (uint64_t i = codeEnd; i < codeBytes; ++i) {
+        if (codeTable[i] != 0) throw runtime_error("Library padding is not zero: " + path);
+    }
+}
+
+// Function to write compiled expressions, with their tables and checksum, as a library.
+void writeCompiledLibrary(const vector<CompiledExpression>& programs, const BooleanDefinitions& definitions,
+                          ostream& out) {
+    vector<LibraryEntry> entries;
+    string variables;             // Variable names of every expression, back to back.
+    vector<uint8_t> code;         // Bytecode of every expression, back to back.
+    entries.reserve(programs.size());
+    for (const CompiledExpression& program : programs) {
+        if (program.code.size() > UINT32_MAX || variables.size() > UINT32_MAX - program.variables.size()) {
+            throw runtime_error("Expression too large for a library");
+        }
+        LibraryEntry entry;
+        entry.codeStart = code.size();
+        entry.codeLength = static_cast<uint32_t>(program.code.size());
+        entry.maxDepth = static_cast<uint32_t>(program.maxDepth);
+        entry.variablesStart = static_cast<uint32_t>(variables.size());
+        entry.variableCount = static_cast<uint32_t>(program.variables.size());
+        entries.push_back(entry);
+        variables += program.variables;
+        code.insert(code.end(), program.code.begin(), program.code.end());
+    }
+
+    // Lay out the tables after the header, padding the end so the checksum covers whole words.
+    LibraryHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LIBRARY_MAGIC, sizeof(LIBRARY_MAGIC));
+    header.version = LIBRARY_VERSION;
+    header.byteOrder = LIBRARY_BYTE_ORDER;
+    header.trueDef = static_cast<uint8_t>(definitions.trueDef);
+    header.falseDef = static_cast<uint8_t>(definitions.falseDef);
+    header.opcodeCount = OP_LOAD_VAR + 1;
+    header.operatorSignature = operatorSignature();
+    header.expressionCount = entries.size();
+    header.variablesOffset = sizeof(LibraryHeader) + entries.size() * sizeof(LibraryEntry);
+    header.codeOffset = header.variablesOffset + variables.size();
+    header.fileSize = (header.codeOffset + code.size() + 7) / 8 * 8;
+
+    vector<uint8_t> body(header.fileSize - sizeof(LibraryHeader), 0);
+    uint8_t* p = body.data();
+    if (!entries.empty()) memcpy(p, entries.data(), entries.size() * sizeof(LibraryEntry));
+    p += entries.size() * sizeof(LibraryEntry);
+    memcpy(p, variables.data(), variables.size());
+    p += variables.size();
+    if (!code.empty()) memcpy(p, code.data(), code.size());
+    header.checksum = libraryChecksum(body.data(), body.size());
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(body.data()), static_cast<streamsize>(body.size()));
+}
+
+// Function to compile an expression file, one expression per line, into a library.
+int runExport(const string& inputPath, const string& outputPath, const BooleanDefinitions& definitions) {
+    BatchInput input(inputPath);  // Map or read the whole expression file.
+    vector<CompiledExpression> programs;
+    const char* lineStart = input.data;
+    const char* end = input.data + input.size;
+    for (size_t lineNumber = 1; lineStart < end; ++lineNumber) {
+        const char* lineEnd = lineStart;
+        while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+        const char* textEnd = (lineEnd > lineStart && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;  // Drop Windows line endings.
+        const char* first = lineStart;
+        while (first < textEnd && isspace(static_cast<unsigned char>(*first))) ++first;
+        if (first < textEnd && *first != '#') {  // Skip blank lines and comments, as netlists do.
+            try {
+                programs.push_back(compileExpression(string(lineStart, textEnd), definitions, true));
+            } catch (exception& e) {  // Name the line in the file, since an expression index would be hard to find.
+                throw runtime_error("Line " + to_string(lineNumber) + ": " + e.what());
+            }
+        }
+        lineStart = lineEnd + 1;
+    }
+
+    if (outputPath == "-") {
+        writeCompiledLibrary(programs, definitions, cout);
+        if (!cout.flush()) throw runtime_error("Unable to write output file: " + outputPath);
+        return 0;
+    }
+    ofstream file(outputPath, ios::binary);
+    if (!file) throw runtime_error("Unable to open output file: " + outputPath);
+    writeCompiledLibrary(programs, definitions, file);
+    if (!file.flush()) throw runtime_error("Unable to write output file: " + outputPath);
+    return 0;
+}
+
+// Function to read one line of assignments, such as "A=1 B=0", into a value per letter.
+static void readAssignments(const char* begin, const char* end, const BooleanDefinitions& definitions, uint8_t values[128]) {
+    memset(values, 0, 128);
+    const char* p = begin;
+    while (p < end) {
+        if (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r') {
+            ++p;
+            continue;
+        }
+        char name = *p++;
+        if (!isalpha(static_cast<unsigned char>(name))) throw runtime_error("Invalid variable: " + string(1, name));
+        if (p + 1 >= end || *p != '=') throw runtime_error("Expected a value after " + string(1, name) + "=");
+        char value = p[1];
+        p += 2;
+        if (value == '1' || value == definitions.trueDef) values[static_cast<uint8_t>(name)] = 1;
+        else if (value == '0' || value == definitions.falseDef) values[static_cast<uint8_t>(name)] = 0;
+        else throw runtime_error("Invalid value for " + string(1, name) + ": " + string(1, value));
+    }
+}
+
+// Function to load a library and summarize it, or evaluate it for every line of assignments.
+int runLibrary(const string& libraryPath, const string& stimulusPath, const string& outputPath,
+               const BooleanDefinitions& definitions) {
+    CompiledLibrary library(libraryPath, definitions);
+    unique_ptr<BatchInput> input;  // Stimulus, opened before the output so a bad path leaves the output alone.
+    if (!stimulusPath.empty()) input.reset(new BatchInput(stimulusPath));
+    BatchOutput out = openBatchOutput(outputPath);  // Open the output target.
+    string text;                  // Output waiting to be written.
+
+    if (stimulusPath.empty()) {
+        size_t codeBytes = 0;
+        for (size_t i = 0; i < library.size(); ++i) codeBytes += library.expression(i).length;
+        char summary[256];
+        snprintf(summary, sizeof(summary), "Expressions: %zu, bytecode: %zu bytes, largest stack: %zu\n",
+                 library.size(), codeBytes, library.maxDepth());
+        text += summary;
+    } else {
+        vector<uint8_t> stack(library.maxDepth());
+        uint8_t values[128];      // Value of every letter on the current line.
+        const char* lineStart = input->data;
+        const char* end = input->data + input->size;
+        while (lineStart < end) {
+            const char* lineEnd = lineStart;
+            while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+            try {
+                readAssignments(lineStart, lineEnd, definitions, values);
+                for (size_t i = 0; i < library.size(); ++i) {
+                    LibraryExpression expression = library.expression(i);
+                    uint64_t assignment = 0;  // Gather the letters this expression reads into its bit order.
+                    for (size_t v = 0; v < expression.variableCount; ++v) {
+                        assignment |= static_cast<uint64_t>(values[static_cast<uint8_t>(expression.variables[v]) & 127]) << v;
+                    }
+                    text += library.evaluate(i, stack.data(), assignment) ? definitions.trueDef : definitions.falseDef;
+                }
+                text += '\n';
+            } catch (exception& e) {  // Report errors inline so output lines stay aligned with input lines.
+                text += "Error: ";
+                text += e.what();
+                text += '\n';
+            }
+            if (text.size() >= (1 << 16)) {
+                fwrite(text.data(), 1, text.size(), out.get());
+                text.clear();
+            }
+            lineStart = lineEnd + 1;
+        }
+    }
+
+    fwrite(text.data(), 1, text.size(), out.get());
+    closeBatchOutput(out, outputPath);
+    return 0;
+}
@@ -0,0 +1,112 @@
+#ifndef COMPILEDLIBRARY_H
+#define COMPILEDLIBRARY_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <ostream>                // Include the library for output streams.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "BatchInput.h"           // Include the user-defined header file that declares the file mapping.
+
+// On-disk layout of a library of compiled expressions, written in the machine's byte order:
+//   LibraryHeader, then one LibraryEntry per expression, then the variable names of every expression,
+//   then the bytecode of every expression, zero-padded to a multiple of eight bytes.
+// Expressions are stored back to back in both tables. The checksum covers everything after the header, and
+// loading rejects nonzero reserved bytes or padding, so every byte of a library is accounted for. A library
+// only loads with the true and false characters and the operator definitions it was built with, since its
+// bytecode already has them resolved.
+
+const char LIBRARY_MAGIC[8] = {'B', 'O', 'O', 'L', 'L', 'I', 'B', '\0'};  // First bytes of every library.
+const uint32_t LIBRARY_VERSION = 2;           // Format version, raised whenever the layout changes.
+const uint32_t LIBRARY_BYTE_ORDER = 0x01020304;  // Marker that reads differently on the other byte order.
+
+struct LibraryHeader {            // Define a structure for the start of a library file.
+    char magic[8];                // Member holding LIBRARY_MAGIC.
+    uint32_t version;             // Member holding LIBRARY_VERSION.
+    uint32_t byteOrder;           // Member holding LIBRARY_BYTE_ORDER as written by the exporting machine.
+    uint8_t trueDef;              // Member holding the character that stood for true.
+    uint8_t falseDef;             // Member holding the character that stood for false.
+    uint8_t opcodeCount;          // Member holding the number of opcodes the bytecode may use.
+    uint8_t reserved[5];          // Member reserved for later versions, written as zero.
+    uint64_t operatorSignature;   // Member holding operatorSignature() of the exporting build.
+    uint64_t expressionCount;     // Member holding the number of expressions.
+    uint64_t variablesOffset;     // Member holding the file offset of the variable names.
+    uint64_t codeOffset;          // Member holding the file offset of the bytecode.
+    uint64_t fileSize;            // Member holding the size of the whole file.
+    uint64_t checksum;            // Member holding libraryChecksum() of everything after the header.
+};
+
+struct LibraryEntry {             // Define a structure locating one expression inside a library.
+    uint64_t codeStart;           // Member holding the offset of its bytecode from the code table.
+    uint32_t codeLength;          // Member holding the length of its bytecode.
+    uint32_t maxDepth;            // Member holding the stack depth it needs.
+    uint32_t variablesStart;      // Member holding the offset of its variable names from the variable table.
+    uint32_t variableCount;       // Member holding the number of its variables.
+};
+
+static_assert(sizeof(LibraryHeader) % 8 == 0 && sizeof(LibraryEntry) % 8 == 0, "Tables must stay 8-byte aligned");
+
+struct LibraryExpression {        // Define a structure viewing one expression inside a loaded library.
+    const uint8_t* code;          // Member pointing at its bytecode.
+    size_t length;                // Member holding the length of its bytecode.
+    size_t maxDepth;              // Member holding the stack depth it needs.
+    const char* variables;        // Member pointing at its variable names, sorted, indexed by OP_LOAD_VAR.
+    size_t variableCount;         // Member holding the number of its variables.
+};
+
+// Class that maps a library file and evaluates its expressions in place. Loading checks the header, the
+// checksum and every program once; after that, nothing is parsed, copied or allocated per expression.
+class CompiledLibrary {
+public:
+    // Map and check a library, rejecting one built with other true/false characters or operators.
+    CompiledLibrary(const std::string& path, const BooleanDefinitions& definitions);
+
+    size_t size() const { return count; }             // Number of expressions.
+    size_t maxDepth() const { return largestDepth; }  // Stack depth enough for every expression.
+
+    // View one expression inside the mapping.
+    LibraryExpression expression(size_t index) const {
+        const LibraryEntry& entry = entries[index];
+        return {codeTable + entry.codeStart, entry.codeLength, entry.maxDepth,
+                variableTable + entry.variablesStart, entry.variableCount};
+    }
+
+    // Evaluate one expression against a stack holding at least maxDepth() values.
+    // Bit i of the assignment holds the value of the expression's variable i.
+    bool evaluate(size_t index, uint8_t* stack, uint64_t assignment = 0) const {
+        const LibraryEntry& entry = entries[index];
+        return runProgram(codeTable + entry.codeStart, entry.codeLength, stack, assignment);
+    }
+
+private:
+    BatchInput input;             // Mapping of the library file.
+    const LibraryEntry* entries = nullptr;  // Table locating every expression.
+    const char* variableTable = nullptr;    // Variable names of every expression.
+    const uint8_t* codeTable = nullptr;     // Bytecode of every expression.
+    size_t count = 0;             // Number of expressions.
+    size_t largestDepth = 0;      // Largest stack depth of any expression.
+};
+
+uint64_t operatorSignature();     // Fingerprint of the operator symbols, precedence and opcodes of this build.
+
+// Checksum of a block of whole 64-bit words, mixed xxHash64-style a word at a time.
+uint64_t libraryChecksum(const uint8_t* data, size_t size);
+
+// Write compiled expressions as a library built with the given true and false characters.
+void writeCompiledLibrary(const std::vector<CompiledExpression>& programs, const BooleanDefinitions& definitions,
+                          std::ostream& out);
+
+// Compile every line of an expression file, allowing variables, and write them as a library. Blank lines and
+// lines starting with '#' are skipped; a line that does not compile stops the export, naming its line number.
+// Returns the process exit code.
+int runExport(const std::string& inputPath, const std::string& outputPath, const BooleanDefinitions& definitions);
+
+// Load a library and summarize it, or evaluate every expression for each line of assignments such as
+// "A=1 B=0", writing one true/false character per expression. Unassigned variables are false.
+// Returns the process exit code.
+int runLibrary(const std::string& libraryPath, const std::string& stimulusPath, const std::string& outputPath,
+               const BooleanDefinitions& definitions);
+
+#endif // COMPILEDLIBRARY_H
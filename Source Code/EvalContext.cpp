@@ -0,0 +1,36 @@
+/*
+ * EvalContext.cpp : Reentrant evaluation state that replaces the global true/false definitions.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include "PostfixEval.h"          // Include the user-defined header file that declares the postfix evaluator.
+#include "EvalContext.h"          // Include the user-defined header file that declares the evaluation context.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Constructor that sets the definitions used by every evaluation in this context.
+EvalContext::EvalContext(const BooleanDefinitions& definitions, size_t cacheCapacity)
+    : current(definitions), cache(cacheCapacity) {}
+
+// Function to parse and evaluate an expression in one pass, reusing this context's buffers.
+bool EvalContext::evaluate(string_view expression) {
+    return evaluateExpression(expression, scratch, current);
+}
+
+// Function to evaluate an expression the way the calculator does, reusing earlier parses.
+bool EvalContext::calculate(const string& expression) {
+    return evalPostfix(cache.postfix(expression, current), current);
+}
+
+// Function to compile an expression under this context's definitions.
+CompiledExpression EvalContext::compile(const string& expression, bool allowVariables) const {
+    return compileExpression(expression, current, allowVariables);
+}
+
+// Function to run a compiled expression on this context's stack.
+bool EvalContext::run(const CompiledExpression& program, uint64_t assignment) {
+    return runProgram(program, stack, assignment);
+}
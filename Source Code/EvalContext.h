@@ -0,0 +1,37 @@
+#ifndef EVALCONTEXT_H
+#define EVALCONTEXT_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <string>                 // Include the library for string manipulation.
+#include <string_view>            // Include the library for non-owning string references.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "ParseCache.h"           // Include the user-defined header file that declares the parse cache.
+
+// Class that bundles the true/false definitions with every buffer evaluation needs, so nothing is shared
+// between calls that do not share a context. A context is not thread-safe; give each thread its own and
+// evaluation never takes a lock.
+class EvalContext {
+public:
+    // Constructor that sets the definitions used by every evaluation in this context.
+    explicit EvalContext(const BooleanDefinitions& definitions = BooleanDefinitions(), size_t cacheCapacity = 1024);
+
+    BooleanDefinitions& definitions() { return current; }              // Definitions, changeable between calls.
+    const BooleanDefinitions& definitions() const { return current; }  // Definitions in use.
+
+    bool evaluate(std::string_view expression);    // Parse and evaluate in one pass.
+    bool calculate(const std::string& expression); // Parse through the cache, then evaluate the postfix form.
+    CompiledExpression compile(const std::string& expression, bool allowVariables = false) const;  // Compile once.
+    bool run(const CompiledExpression& program, uint64_t assignment = 0);  // Run a compiled expression.
+    ParseCacheStats cacheStats() const { return cache.stats(); }       // Counters of the parse cache.
+
+private:
+    BooleanDefinitions current;   // Characters standing for true and false.
+    EvalScratch scratch;          // Buffers of the fused evaluator.
+    std::vector<uint8_t> stack;   // Stack of the bytecode interpreter.
+    ParseCache cache;             // Recently parsed expressions.
+};
+
+#endif // EVALCONTEXT_H
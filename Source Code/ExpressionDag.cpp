@@ -0,0 +1,177 @@
+/*
+ * ExpressionDag.cpp : Simplified, hash-consed expression graph with short-circuit evaluation.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <algorithm>              // Include the library for swapping.
+#include "ExpressionDag.h"        // Include the user-defined header file that declares the expression graph.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Constructor that builds the graph of a compiled expression.
+ExpressionDag::ExpressionDag(const CompiledExpression& program) : variableNames(program.variables) {
+    falseNode = makeNode(DAG_FALSE, 0, 0);
+    trueNode = makeNode(DAG_TRUE, 0, 0);
+    vector<uint32_t> stack;   // Nodes of the partial results.
+    const vector<uint8_t>& code = program.code;
+    for (size_t i = 0; i < code.size(); ++i) {
+        ++sourceCount;        // Each instruction is one node of the unsimplified tree.
+        switch (code[i]) {
+            case OP_PUSH_TRUE:  stack.push_back(trueNode); break;
+            case OP_PUSH_FALSE: stack.push_back(falseNode); break;
+            case OP_LOAD_VAR:   stack.push_back(makeNode(DAG_VAR, code[++i], 0)); break;
+            case OP_NOT:        stack.back() = makeNot(stack.back()); break;
+            default: {        // Binary operators.
+                uint32_t right = stack.back();
+                stack.pop_back();
+                stack.back() = makeBinary(code[i], stack.back(), right);
+            }
+        }
+    }
+    root = stack.back();
+    countReachable();
+    values.resize(nodes.size());
+    stamps.resize(nodes.size(), 0);
+}
+
+// Function to evaluate the graph for an assignment, where bit i holds variable i.
+bool ExpressionDag::evaluate(uint64_t assignment) {
+    ++currentStamp;           // Invalidate every value from the previous evaluation.
+    lastVisited = 0;
+    frames.clear();
+    frames.push_back({root, 0});
+    while (!frames.empty()) {
+        Frame& frame = frames.back();
+        uint32_t id = frame.node;
+        const DagNode& node = nodes[id];
+        if (stamps[id] == currentStamp) {  // Shared subexpressions are evaluated once.
+            frames.pop_back();
+            continue;
+        }
+        if (frame.stage == 0) ++lastVisited;
+        switch (node.op) {
+            case DAG_FALSE: finish(id, false); break;
+            case DAG_TRUE:  finish(id, true); break;
+            case DAG_VAR:   finish(id, (assignment >> node.a) & 1); break;
+            case DAG_NOT:
+                if (frame.stage++ == 0) frames.push_back({node.a, 0});
+                else finish(id, !values[node.a]);
+                break;
+            case DAG_XOR:     // Both operands are always needed.
+                if (frame.stage == 0) {
+                    frame.stage = 1;
+                    frames.push_back({node.a, 0});
+                } else if (frame.stage == 1) {
+                    frame.stage = 2;
+                    frames.push_back({node.b, 0});
+                } else {
+                    finish(id, values[node.a] != values[node.b]);
+                }
+                break;
+            default: {        // AND, OR and NAND stop once the left operand decides the result.
+                bool controlling = (node.op == DAG_OR);  // Left value that makes the right one irrelevant.
+                if (frame.stage == 0) {
+                    frame.stage = 1;
+                    frames.push_back({node.a, 0});
+                } else if (frame.stage == 1) {
+                    if (values[node.a] == controlling) {
+                        finish(id, (node.op == DAG_NAND) ? true : controlling);
+                    } else {
+                        frame.stage = 2;
+                        frames.push_back({node.b, 0});
+                    }
+                } else {
+                    bool right = values[node.b];
+                    finish(id, (node.op == DAG_NAND) ? !right : right);
+                }
+            }
+        }
+    }
+    return values[root];
+}
+
+// Function to record a node's value for the current evaluation and finish its frame.
+void ExpressionDag::finish(uint32_t id, bool value) {
+    values[id] = value;
+    stamps[id] = currentStamp;
+    frames.pop_back();
+}
+
+// Function to return the shared node with the given fields, creating it if needed.
+uint32_t ExpressionDag::makeNode(DagOp op, uint32_t a, uint32_t b) {
+    uint64_t key = (static_cast<uint64_t>(op) << 56) ^ (static_cast<uint64_t>(a) << 28) ^ b;
+    auto range = unique.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const DagNode& node = nodes[it->second];
+        if (node.op == op && node.a == a && node.b == b) return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({op, a, b});
+    unique.emplace(key, id);
+    return id;
+}
+
+// Function to return whether one node is the negation of the other.
+bool ExpressionDag::isNegation(uint32_t x, uint32_t y) const {
+    return (nodes[x].op == DAG_NOT && nodes[x].a == y) || (nodes[y].op == DAG_NOT && nodes[y].a == x);
+}
+
+// Function to build a negation, folding constants and double negations.
+uint32_t ExpressionDag::makeNot(uint32_t x) {
+    if (x == falseNode) return trueNode;
+    if (x == trueNode) return falseNode;
+    if (nodes[x].op == DAG_NOT) return nodes[x].a;  // !!x is x.
+    return makeNode(DAG_NOT, x, 0);
+}
+
+// Function to build a binary operation, folding constants and simplifying identities.
+uint32_t ExpressionDag::makeBinary(uint8_t opcode, uint32_t x, uint32_t y) {
+    if (x > y) swap(x, y);    // Every operator is commutative, so order operands for sharing.
+    bool hasFalse = (x == falseNode || y == falseNode);
+    bool hasTrue = (x == trueNode || y == trueNode);
+    uint32_t other = (x == falseNode || x == trueNode) ? y : x;  // The non-constant operand, if any.
+    switch (opcode) {
+        case OP_AND:
+            if (hasFalse || isNegation(x, y)) return falseNode;  // x&F and x&!x are false.
+            if (hasTrue) return other;                          // x&T is x.
+            if (x == y) return x;                               // x&x is x.
+            return makeNode(DAG_AND, x, y);
+        case OP_OR:
+            if (hasTrue || isNegation(x, y)) return trueNode;   // x|T and x|!x are true.
+            if (hasFalse) return other;                         // x|F is x.
+            if (x == y) return x;                               // x|x is x.
+            return makeNode(DAG_OR, x, y);
+        case OP_NAND:
+            if (hasFalse || isNegation(x, y)) return trueNode;  // x@F and x@!x are true.
+            if (hasTrue || x == y) return makeNot(other);       // x@T and x@x are !x.
+            return makeNode(DAG_NAND, x, y);
+        default:              // XOR.
+            if (x == y) return falseNode;                       // x$x is false.
+            if (isNegation(x, y)) return trueNode;              // x$!x is true.
+            if (hasFalse) return other;                         // x$F is x.
+            if (hasTrue) return makeNot(other);                 // x$T is !x.
+            return makeNode(DAG_XOR, x, y);
+    }
+}
+
+// Function to count the nodes reachable from the root.
+void ExpressionDag::countReachable() {
+    vector<bool> seen(nodes.size(), false);
+    vector<uint32_t> pending{root};
+    while (!pending.empty()) {
+        uint32_t id = pending.back();
+        pending.pop_back();
+        if (seen[id]) continue;
+        seen[id] = true;
+        ++reachableCount;
+        DagOp op = nodes[id].op;
+        if (op == DAG_NOT) pending.push_back(nodes[id].a);
+        else if (op >= DAG_AND) {
+            pending.push_back(nodes[id].a);
+            pending.push_back(nodes[id].b);
+        }
+    }
+}
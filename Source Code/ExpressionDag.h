@@ -0,0 +1,70 @@
+#ifndef EXPRESSIONDAG_H
+#define EXPRESSIONDAG_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <unordered_map>          // Include the library for the hash map container.
+#include "Bytecode.h"             // Include the user-defined header file that declares the bytecode format.
+
+enum DagOp : uint8_t {            // Define an enumeration of the kinds of graph node.
+    DAG_FALSE,                    // Constant false.
+    DAG_TRUE,                     // Constant true.
+    DAG_VAR,                      // Variable whose index is stored in the first operand.
+    DAG_AND,                      // AND of two nodes.
+    DAG_OR,                       // OR of two nodes.
+    DAG_NAND,                     // NAND of two nodes.
+    DAG_XOR,                      // XOR of two nodes.
+    DAG_NOT                       // Negation of one node.
+};
+
+// Class that builds a directed acyclic graph from compiled bytecode, folding constants, simplifying identities
+// and sharing identical subexpressions, then evaluates it while skipping operands that cannot change the result.
+class ExpressionDag {
+public:
+    explicit ExpressionDag(const CompiledExpression& program);  // Build the graph of a compiled expression.
+
+    bool evaluate(uint64_t assignment);  // Evaluate the graph for an assignment, where bit i holds variable i.
+
+    size_t sourceNodes() const { return sourceCount; }       // Nodes before simplification and sharing.
+    size_t dagNodes() const { return reachableCount; }       // Distinct nodes the simplified expression needs.
+    size_t eliminatedNodes() const { return sourceCount - reachableCount; }  // Nodes removed.
+    size_t visitedNodes() const { return lastVisited; }      // Nodes visited by the last evaluation.
+    const std::string& variables() const { return variableNames; }  // Variable names, indexed like assignment bits.
+
+private:
+    struct DagNode {              // Define a structure for one graph node.
+        DagOp op;                 // Member holding the kind of node.
+        uint32_t a;               // Member holding the first operand, or the variable index.
+        uint32_t b;               // Member holding the second operand.
+    };
+
+    struct Frame {                // Define a structure for one pending step of the evaluation.
+        uint32_t node;            // Member holding the node being evaluated.
+        uint8_t stage;            // Member holding how many operands have been handled.
+    };
+
+    void finish(uint32_t id, bool value);                   // Record a node's value and finish its frame.
+    uint32_t makeNode(DagOp op, uint32_t a, uint32_t b);    // Return the shared node with these fields.
+    bool isNegation(uint32_t x, uint32_t y) const;          // Whether one node negates the other.
+    uint32_t makeNot(uint32_t x);                           // Build a simplified negation.
+    uint32_t makeBinary(uint8_t opcode, uint32_t x, uint32_t y);  // Build a simplified binary operation.
+    void countReachable();                                  // Count the nodes reachable from the root.
+
+    std::vector<DagNode> nodes;   // Every node created, children before parents.
+    std::unordered_multimap<uint64_t, uint32_t> unique;  // Nodes indexed by a hash of their fields.
+    std::string variableNames;    // Variable names, indexed like the bits of an assignment.
+    uint32_t falseNode = 0;       // Node for constant false.
+    uint32_t trueNode = 0;        // Node for constant true.
+    uint32_t root = 0;            // Node for the whole expression.
+    size_t sourceCount = 0;       // Nodes in the unsimplified expression.
+    size_t reachableCount = 0;    // Distinct nodes the simplified expression needs.
+    std::vector<uint8_t> values;  // Value of each node in the current evaluation.
+    std::vector<uint64_t> stamps; // Evaluation in which each value was computed.
+    uint64_t currentStamp = 0;    // Number of the current evaluation.
+    std::vector<Frame> frames;    // Pending evaluation steps, reused between evaluations.
+    size_t lastVisited = 0;       // Nodes visited by the last evaluation.
+};
+
+#endif // EXPRESSIONDAG_H
@@ -0,0 +1,82 @@
+/*
+ * ExpressionGenerator.cpp : Seeded generator of random expressions with controlled length, depth and operator mix.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <algorithm>              // Include the library for max.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the generator.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+static const char binaryOperators[] = {'&', '|', '@', '$'};  // Operators in the order of the weights.
+
+// Constructor that seeds the generator and prepares the operator distribution.
+ExpressionGenerator::ExpressionGenerator(const GeneratorOptions& options, const BooleanDefinitions& definitions,
+                                         uint64_t seed)
+    : options(options), definitions(definitions), rng(seed),
+      operatorChoice(begin(options.operatorWeights), end(options.operatorWeights)) {}
+
+// Function to build the next expression.
+string ExpressionGenerator::next() {
+    string expression;
+    build(max<size_t>(1, options.operands), options.maxDepth, expression);
+    return expression;
+}
+
+// Function to append a subexpression with the given number of operands and remaining nesting depth.
+void ExpressionGenerator::build(size_t operands, size_t depthLeft, string& out) {
+    if (operands == 1) {
+        operand(out);
+        return;
+    }
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    size_t left;                  // Number of operands on the left of the operator.
+    if (chance(rng) < options.chainChance) {
+        left = (rng() & 1) ? 1 : operands - 1;  // Peel off one operand so the other side nests deeper.
+    } else {
+        left = 1 + rng() % (operands - 1);
+    }
+    char op = binaryOperators[operatorChoice(rng)];
+
+    // Function to append one side, in parentheses when the depth allows and the dice say so.
+    auto side = [&](size_t count) {
+        bool wrap = count > 1 && depthLeft > 0 && chance(rng) < options.parenChance;
+        if (!wrap) {
+            build(count, depthLeft, out);
+            return;
+        }
+        if (chance(rng) < options.notChance) out += '!';
+        out += '(';
+        build(count, depthLeft - 1, out);
+        out += ')';
+    };
+    side(left);
+    out += ' ';
+    out += op;
+    out += ' ';
+    side(operands - left);
+}
+
+// Function to append a literal or variable, negated some of the time.
+void ExpressionGenerator::operand(string& out) {
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    if (chance(rng) < options.notChance) out += '!';
+    if (!options.variables.empty() && chance(rng) < options.variableChance) {
+        out += options.variables[rng() % options.variables.size()];
+    } else {
+        out += (rng() & 1) ? definitions.trueDef : definitions.falseDef;
+    }
+}
+
+// Function to return the deepest parenthesis nesting of an expression.
+size_t expressionDepth(const string& expression) {
+    size_t depth = 0, deepest = 0;
+    for (char c : expression) {
+        if (c == '(') deepest = max(deepest, ++depth);
+        else if (c == ')' && depth > 0) --depth;
+    }
+    return deepest;
+}
@@ -0,0 +1,40 @@
+#ifndef EXPRESSIONGENERATOR_H
+#define EXPRESSIONGENERATOR_H
+
+#include <cstddef>                // Include the library for size types.
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+struct GeneratorOptions {         // Define a structure describing the shape of generated expressions.
+    size_t operands = 8;          // Member holding the number of operands in each expression.
+    size_t maxDepth = 4;          // Member holding the deepest parenthesis nesting allowed.
+    double parenChance = 0.5;     // Member holding the chance a compound operand is parenthesized.
+    double chainChance = 0.0;     // Member holding the chance a split peels off one operand, nesting deeper.
+    double notChance = 0.1;       // Member holding the chance an operand is negated.
+    double operatorWeights[4] = {1, 1, 1, 1};  // Member holding the relative frequency of &, |, @ and $.
+    std::string variables;        // Member holding the letters used as variables, if any.
+    double variableChance = 0.0;  // Member holding the chance an operand is a variable rather than a literal.
+};
+
+// Class that builds random, well-formed infix expressions from a seed, so a corpus can be regenerated exactly.
+class ExpressionGenerator {
+public:
+    ExpressionGenerator(const GeneratorOptions& options, const BooleanDefinitions& definitions, uint64_t seed);
+
+    std::string next();           // Build the next expression.
+
+private:
+    void build(size_t operands, size_t depthLeft, std::string& out);  // Append a subexpression.
+    void operand(std::string& out);                                  // Append a single operand.
+
+    GeneratorOptions options;     // Shape of the expressions.
+    BooleanDefinitions definitions;  // Characters used for the literals.
+    std::mt19937_64 rng;          // Seeded random source.
+    std::discrete_distribution<int> operatorChoice;  // Distribution over the binary operators.
+};
+
+size_t expressionDepth(const std::string& expression);  // Return the deepest parenthesis nesting of an expression.
+
+#endif // EXPRESSIONGENERATOR_H
@@ -0,0 +1,46 @@
+/*
+ * FastEval.cpp : Single-pass parse-and-evaluate fast path that runs without heap allocation.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cctype>                 // Include the library for character classification functions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to build the character table from the parser's own operator definitions, so the two cannot disagree.
+static CharacterTable buildCharacterTable() {
+    CharacterTable table;
+    for (int i = 0; i < 256; ++i) {
+        char c = static_cast<char>(i);
+        table.space[i] = isspace(i) != 0;
+        table.alpha[i] = isalpha(i) != 0;
+        table.precedence[i] = isOperator(c) ? static_cast<int8_t>(getPrecedence(c)) : 0;
+        table.displaces[i] = static_cast<int8_t>(table.precedence[i] + (isOperator(c) && !isLeftAssociative(c)));
+    }
+    table.precedence[static_cast<unsigned char>('(')] = -1;
+    return table;
+}
+
+// Function to return the character table, built on first use.
+const CharacterTable& characterTable() {
+    static const CharacterTable table = buildCharacterTable();
+    return table;
+}
+
+// Function to parse and evaluate an expression in one pass using caller-provided buffers.
+// Once the buffers have grown to the deepest expression seen, no further allocation happens.
+bool evaluateExpression(string_view expression, EvalScratch& scratch, const BooleanDefinitions& definitions) {
+    FusedEvaluator evaluator(scratch, definitions);
+    for (char c : expression) evaluator.feed(c);
+    return evaluator.finish();
+}
+
+// Function to parse and evaluate an expression in one pass using buffers owned by the calling thread.
+bool evaluateExpression(string_view expression, const BooleanDefinitions& definitions) {
+    thread_local EvalScratch scratch;  // Buffers reused by every call on this thread.
+    return evaluateExpression(expression, scratch, definitions);
+}
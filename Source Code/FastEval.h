@@ -0,0 +1,144 @@
+#ifndef FASTEVAL_H
+#define FASTEVAL_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <string>                 // Include the library for string manipulation.
+#include <string_view>            // Include the library for non-owning string references.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "FileParse.h"            // Include the user-defined header file that declares the operator helpers.
+
+struct EvalScratch {              // Define a structure for the buffers the fused evaluator reuses between expressions.
+    std::vector<char> operators;  // Member holding the operator and parenthesis stack.
+    std::vector<uint8_t> values;  // Member holding the value stack.
+};
+
+struct CharacterTable {           // Define a structure classifying every character for the fused evaluator.
+    int8_t precedence[256];       // Member holding each operator's precedence, -1 for '(' and 0 otherwise.
+    int8_t displaces[256];        // Member holding the lowest stacked precedence each operator applies first.
+    bool space[256];              // Member holding whether each character is whitespace.
+    bool alpha[256];              // Member holding whether each character is a letter.
+};
+
+// Return the character table, built once from isOperator, getPrecedence and isLeftAssociative.
+const CharacterTable& characterTable();
+
+// Class that runs the shunting yard algorithm and evaluates each operator as soon as it leaves the operator stack,
+// so no postfix string is built. It reports exactly the errors shuntingYard and evalPostfix would.
+class FusedEvaluator {
+public:
+    // Constructor that empties the scratch buffers while keeping their capacity.
+    FusedEvaluator(EvalScratch& scratch, const BooleanDefinitions& definitions)
+        : operators(scratch.operators), values(scratch.values), table(characterTable()),
+          trueDef(definitions.trueDef), falseDef(definitions.falseDef) {
+        operators.clear();
+        values.clear();
+    }
+
+    // Function to process the next character of the expression.
+    void feed(char c) {
+        sawInput = true;
+        unsigned char u = static_cast<unsigned char>(c);
+        if (table.space[u]) return;   // Skip whitespace characters.
+        if (table.alpha[u] && (c == trueDef || c == falseDef)) {  // Boolean literal.
+            if (!expectOperand) {
+                throw std::runtime_error("Operand follows another operand or does not follow an operator");
+            }
+            if (!deferredError) values.push_back(c == trueDef);  // After an error only the parse is checked.
+            expectOperand = false;
+            return;
+        }
+
+        if (table.precedence[u] > 0) {  // Operator.
+            if (expectOperand && c != '!') {
+                throw std::runtime_error("Missing operand before operator: " + std::string(1, c));
+            } else if (!expectOperand && c == '!') {
+                throw std::runtime_error("Consecutive operators detected without operand in between.");
+            }
+            // Apply operators that bind at least as tightly; '(' has the lowest precedence, so it stops the loop.
+            while (!operators.empty() &&
+                   table.precedence[static_cast<unsigned char>(operators.back())] >= table.displaces[u]) {
+                apply(operators.back());
+                operators.pop_back();
+            }
+            operators.push_back(c);
+            expectOperand = true;
+        } else if (c == '(') {
+            operators.push_back(c);
+            expectOperand = true;
+        } else if (c == ')') {
+            while (!operators.empty() && operators.back() != '(') {  // Apply operators back to the opening parenthesis.
+                apply(operators.back());
+                operators.pop_back();
+            }
+            if (operators.empty()) throw std::runtime_error("Mismatched parentheses");
+            operators.pop_back();
+            expectOperand = false;
+        } else {
+            throw std::invalid_argument("Invalid character or operator: " + std::string(1, c));
+        }
+    }
+
+    // Function to apply the remaining operators and return the value of the expression.
+    bool finish() {
+        if (!sawInput) throw std::runtime_error("No operands or operators present");
+        for (char op : operators) {  // shuntingYard reports a leftover parenthesis before a trailing operator.
+            if (op == '(') throw std::runtime_error("Mismatched parentheses");
+        }
+        if (expectOperand) throw std::runtime_error("Missing operand after operator");
+        while (!operators.empty()) {
+            apply(operators.back());
+            operators.pop_back();
+        }
+        if (deferredError) throw std::runtime_error(deferredError);  // evalPostfix would have failed on this operator.
+        if (values.empty()) throw std::runtime_error("No operands or operators present");
+        return values.back();     // Return the value on top of the stack, as evalPostfix does.
+    }
+
+private:
+    // Function to apply one operator to the value stack. A missing operand is only reported once the whole
+    // expression has parsed, because shuntingYard errors come before evalPostfix errors. From then on no value
+    // is pushed or applied, so a long erroneous stream does not grow the value stack.
+    void apply(char op) {
+        if (deferredError) return;
+        if (op == '!') {
+            if (values.empty()) {
+                deferredError = "Missing operand for NOT operation";
+                return;
+            }
+            values.back() = !values.back();
+            return;
+        }
+        if (values.size() < 2) {
+            deferredError = "Missing operand for binary operator";
+            return;
+        }
+        uint8_t right = values.back();
+        values.pop_back();
+        uint8_t& left = values.back();
+        switch (op) {
+            case '&': left = left & right; break;     // AND operation.
+            case '|': left = left | right; break;     // OR operation.
+            case '@': left = !(left & right); break;  // NAND operation.
+            case '$': left = left ^ right; break;     // XOR operation.
+        }
+    }
+
+    std::vector<char>& operators;     // Operator and parenthesis stack.
+    std::vector<uint8_t>& values;     // Value stack.
+    const CharacterTable& table;      // Classification of every character.
+    char trueDef;                     // Character standing for true.
+    char falseDef;                    // Character standing for false.
+    bool expectOperand = true;        // Whether the next token should be an operand.
+    bool sawInput = false;            // Whether any character has been fed.
+    const char* deferredError = nullptr;  // First evaluation error, reported after parsing succeeds.
+};
+
+// Parse and evaluate an expression in one pass using caller-provided buffers.
+bool evaluateExpression(std::string_view expression, EvalScratch& scratch, const BooleanDefinitions& definitions);
+
+// Parse and evaluate an expression in one pass using buffers owned by the calling thread.
+bool evaluateExpression(std::string_view expression, const BooleanDefinitions& definitions);
+
+#endif // FASTEVAL_H
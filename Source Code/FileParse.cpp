@@ -11,7 +11,7 @@
  *   - Jack Pigott
  *
  * Creation Date: April 24, 2024
- * Modification Date: May 2, 2024
+ * Modification Date: October 17, 2026
  * 
  */
 
@@ -22,7 +22,7 @@
 #include <unordered_set>          // Include the library that provides the unordered set container.
 #include <exception>              // Include the library for exception handling utilities.
 #include "TokenType.h"            // Include the user-defined header file that defines the TokenType enumeration.
-#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
 
 using namespace std;              // Declare usage of the standard namespace to avoid prefixing std:: on standard library types and functions.
 
@@ -31,30 +31,7 @@ struct Token {                    // Define a structure to represent a token.
     char value;                   // Member to store the character value of the token.
 };
 
-bool isOperator(char c) {         // Function to check if a character is one of the predefined operators.
-    return c == '&' || c == '|' || c == '!' || c == '@' || c == '$';  // Returns true if the character matches one of the logical operators.
-}
-
-bool isParen(char c) {            // Function to check if a character is a parenthesis.
-    return c == '(' || c == ')';  // Returns true if the character is an opening or closing parenthesis.
-}
-
-int getPrecedence(char c) {       // Function to determine the precedence of an operator.
-    switch (c) {                  // Switch statement on the character.
-        case '!': return 3;       // NOT operator has the highest precedence.
-        case '$': return 2;       // XOR operator has second highest precedence.
-        case '&': return 2;       // AND operator has second highest precedence.
-        case '|': return 1;       // OR operator has lowest precedence.
-        case '@': return 1;       // NAND operator has lowest precedence.
-        default: throw invalid_argument("Unrecognized operator symbol: " + string(1, c));  // Throw an exception if the operator is not recognized. 
-    }
-}
-
-bool isLeftAssociative(char c) {  // Function to determine if an operator is left associative.
-    return c != '!';              // Returns true if the operator is not the NOT operator.
-}
-
-string shuntingYard(const string& expression) {  // Function implementing the shunting yard algorithm to convert infix to postfix notation.
+string shuntingYard(const string& expression, const BooleanDefinitions& definitions, bool allowVariables) {  // Function implementing the shunting yard algorithm to convert infix to postfix notation, optionally accepting single-letter variables.
     if (expression.empty()) throw runtime_error("No operands or operators present");  // Throw an error if the input expression is empty.
 
     stack<Token> operators;       // Stack to hold operators and parentheses during conversion.
@@ -63,7 +40,7 @@ string shuntingYard(const string& expression) {  // Function implementing the sh
 
     for (char c : expression) {   // Iterate over each character in the expression.
         if (isspace(c)) continue; // Skip whitespace characters.
-        if (isalpha(c) && (c == trueDef || c == falseDef)) {  // Check if the character is a valid definition for the boolean values.
+        if (isalpha(c) && (c == definitions.trueDef || c == definitions.falseDef || allowVariables)) {  // Check if the character is a valid definition for the boolean values or a variable name.
             if (!expectOperand) {
                 throw runtime_error("Operand follows another operand or does not follow an operator");  // Error if two operands are found consecutively. 
             }
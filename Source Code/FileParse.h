@@ -0,0 +1,36 @@
+#ifndef FILEPARSE_H
+#define FILEPARSE_H
+
+#include <string>                 // Include the library for using the string type.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+// The operator definitions are constexpr so the compile-time parser in StaticExpression.h shares them.
+
+constexpr bool isOperator(char c) {  // Function to check if a character is one of the predefined operators.
+    return c == '&' || c == '|' || c == '!' || c == '@' || c == '$';  // Returns true if the character matches one of the logical operators.
+}
+
+constexpr bool isParen(char c) {  // Function to check if a character is a parenthesis.
+    return c == '(' || c == ')';  // Returns true if the character is an opening or closing parenthesis.
+}
+
+constexpr int getPrecedence(char c) {  // Function to determine the precedence of an operator.
+    switch (c) {                  // Switch statement on the character.
+        case '!': return 3;       // NOT operator has the highest precedence.
+        case '$': return 2;       // XOR operator has second highest precedence.
+        case '&': return 2;       // AND operator has second highest precedence.
+        case '|': return 1;       // OR operator has lowest precedence.
+        case '@': return 1;       // NAND operator has lowest precedence.
+        default: throw std::invalid_argument("Unrecognized operator symbol: " + std::string(1, c));  // Throw an exception if the operator is not recognized.
+    }
+}
+
+constexpr bool isLeftAssociative(char c) {  // Function to determine if an operator is left associative.
+    return c != '!';              // Returns true if the operator is not the NOT operator.
+}
+
+// Convert an infix expression to postfix notation, optionally accepting single-letter variables.
+std::string shuntingYard(const std::string& expression, const BooleanDefinitions& definitions, bool allowVariables = false);
+
+#endif // FILEPARSE_H
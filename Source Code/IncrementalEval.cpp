@@ -0,0 +1,229 @@
+/*
+ * IncrementalEval.cpp : Event-driven re-evaluation that only follows the fan-out of changed inputs.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdio>                 // Include the library for buffered C file output.
+#include <algorithm>              // Include the library for heap operations.
+#include <functional>             // Include the library for comparison function objects.
+#include <memory>                 // Include the library for owning pointers.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "BatchInput.h"           // Include the user-defined header file that declares the input mapping.
+#include "IncrementalEval.h"      // Include the user-defined header file that declares the incremental evaluator.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+const uint32_t NO_LEAF = UINT32_MAX;  // Marker for a variable the code never loads.
+
+// Constructor that builds one node per instruction, with one shared leaf per variable so a change reaches
+// every place the variable is used, then evaluates the whole graph once.
+IncrementalEvaluator::IncrementalEvaluator(const CompiledExpression& program, uint64_t assignment)
+    : leaves(program.variables.size(), NO_LEAF), variableNames(program.variables), current(assignment) {
+    if (program.variables.size() > 64) throw runtime_error("Too many variables for incremental evaluation");
+    vector<uint32_t> stack;       // Nodes of the partial results.
+    const vector<uint8_t>& code = program.code;
+    auto add = [&](DagOp op, uint32_t a, uint32_t b) {
+        ops.push_back(op);
+        left.push_back(a);
+        right.push_back(b);
+        return static_cast<uint32_t>(ops.size() - 1);
+    };
+    for (size_t i = 0; i < code.size(); ++i) {
+        switch (code[i]) {
+            case OP_PUSH_TRUE:  stack.push_back(add(DAG_TRUE, 0, 0)); break;
+            case OP_PUSH_FALSE: stack.push_back(add(DAG_FALSE, 0, 0)); break;
+            case OP_LOAD_VAR: {
+                uint8_t variable = code[++i];
+                if (leaves[variable] == NO_LEAF) leaves[variable] = add(DAG_VAR, variable, 0);
+                stack.push_back(leaves[variable]);
+                break;
+            }
+            case OP_NOT: stack.back() = add(DAG_NOT, stack.back(), 0); break;
+            default: {            // Binary operators, numbered in the same order as the graph's.
+                uint32_t b = stack.back();
+                stack.pop_back();
+                stack.back() = add(static_cast<DagOp>(DAG_AND + (code[i] - OP_AND)), stack.back(), b);
+            }
+        }
+    }
+    root = stack.back();
+
+    // Group the parents of every node, counting a node twice when it is both operands.
+    size_t count = ops.size();
+    parentStart.assign(count + 1, 0);
+    auto operands = [&](size_t n) { return ops[n] == DAG_NOT ? 1 : (ops[n] >= DAG_AND ? 2 : 0); };
+    for (size_t n = 0; n < count; ++n) {
+        if (operands(n) >= 1) ++parentStart[left[n] + 1];
+        if (operands(n) == 2) ++parentStart[right[n] + 1];
+    }
+    for (size_t n = 0; n < count; ++n) parentStart[n + 1] += parentStart[n];
+    parents.resize(parentStart[count]);
+    vector<uint32_t> fill(parentStart.begin(), parentStart.end() - 1);
+    for (size_t n = 0; n < count; ++n) {
+        if (operands(n) >= 1) parents[fill[left[n]]++] = static_cast<uint32_t>(n);
+        if (operands(n) == 2) parents[fill[right[n]]++] = static_cast<uint32_t>(n);
+    }
+
+    values.resize(count);
+    queued.assign(count, 0);
+    for (size_t n = 0; n < count; ++n) values[n] = compute(static_cast<uint32_t>(n));  // Children come first.
+    updated = count;
+}
+
+// Function to move to a new assignment, re-evaluating only what the changed variables reach.
+bool IncrementalEvaluator::assign(uint64_t assignment) {
+    uint64_t changed = assignment ^ current;
+    current = assignment;
+    propagate(changed);
+    return result();
+}
+
+// Function to change one variable.
+bool IncrementalEvaluator::set(size_t variable, bool value) {
+    uint64_t bit = 1ULL << variable;
+    return assign(value ? (current | bit) : (current & ~bit));
+}
+
+// Function to flip one variable.
+bool IncrementalEvaluator::toggle(size_t variable) {
+    return assign(current ^ (1ULL << variable));
+}
+
+// Function to re-evaluate the fan-out of the changed variables in graph order, so each node is computed at
+// most once and only after every changed operand. Propagation stops at nodes whose value is unchanged.
+void IncrementalEvaluator::propagate(uint64_t changed) {
+    updated = 0;
+    for (size_t variable = 0; variable < leaves.size(); ++variable) {
+        if (!((changed >> variable) & 1) || leaves[variable] == NO_LEAF) continue;
+        values[leaves[variable]] = (current >> variable) & 1;
+        schedule(leaves[variable]);
+    }
+    while (!heap.empty()) {
+        pop_heap(heap.begin(), heap.end(), greater<uint32_t>());
+        uint32_t node = heap.back();
+        heap.pop_back();
+        queued[node] = 0;
+        ++updated;
+        bool value = compute(node);
+        if (value == values[node]) continue;  // Nothing above this node can change through it.
+        values[node] = value;
+        schedule(node);
+    }
+}
+
+// Function to queue a node's parents for re-evaluation, once each.
+void IncrementalEvaluator::schedule(uint32_t node) {
+    for (uint32_t k = parentStart[node]; k < parentStart[node + 1]; ++k) {
+        uint32_t parent = parents[k];
+        if (queued[parent]) continue;
+        queued[parent] = 1;
+        heap.push_back(parent);
+        push_heap(heap.begin(), heap.end(), greater<uint32_t>());
+    }
+}
+
+// Function to compute a node's value from its operands' current values.
+bool IncrementalEvaluator::compute(uint32_t node) const {
+    switch (ops[node]) {
+        case DAG_FALSE: return false;
+        case DAG_TRUE:  return true;
+        case DAG_VAR:   return (current >> left[node]) & 1;
+        case DAG_AND:   return values[left[node]] & values[right[node]];
+        case DAG_OR:    return values[left[node]] | values[right[node]];
+        case DAG_NAND:  return !(values[left[node]] & values[right[node]]);
+        case DAG_XOR:   return values[left[node]] ^ values[right[node]];
+        default:        return !values[left[node]];  // NOT.
+    }
+}
+
+// Function to apply one line of changes, such as "A=1 !B C=0", to an evaluator.
+void applyDeltaLine(IncrementalEvaluator& evaluator, const char* begin, const char* end,
+                    const BooleanDefinitions& definitions) {
+    uint64_t assignment = evaluator.assignment();
+    const string& names = evaluator.variables();
+    const char* p = begin;
+    while (p < end) {
+        if (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r') {
+            ++p;
+            continue;
+        }
+        bool flip = (*p == '!' || *p == '~');
+        if (flip) ++p;
+        if (p == end) throw runtime_error("Missing variable after '!'");
+        size_t variable = names.find(*p);
+        if (variable == string::npos) throw runtime_error("Unknown variable: " + string(1, *p));
+        ++p;
+        if (flip) {
+            assignment ^= 1ULL << variable;
+            continue;
+        }
+        if (p + 1 >= end || *p != '=') {
+            throw runtime_error("Expected a value after " + string(1, names[variable]) + "=");
+        }
+        char value = p[1];
+        p += 2;
+        if (value == '1' || value == definitions.trueDef) assignment |= 1ULL << variable;
+        else if (value == '0' || value == definitions.falseDef) assignment &= ~(1ULL << variable);
+        else throw runtime_error("Invalid value for " + string(1, names[variable]) + ": " + string(1, value));
+    }
+    evaluator.assign(assignment);  // Propagate the whole line at once.
+}
+
+// Function to evaluate an expression for a stream of input changes, or sweep it in Gray-code order.
+int runIncremental(const string& expression, const string& deltaPath, const string& outputPath,
+                   const BooleanDefinitions& definitions) {
+    CompiledExpression program = compileExpression(expression, definitions, true);  // Parse once, allowing variables.
+    IncrementalEvaluator evaluator(program);
+    size_t variableCount = program.variables.size();
+    if (deltaPath.empty() && variableCount > 62) throw runtime_error("Too many variables for a truth table");
+    unique_ptr<BatchInput> input;  // Changes, opened before the output so a bad path leaves the output alone.
+    if (!deltaPath.empty()) input.reset(new BatchInput(deltaPath));
+    BatchOutput out = openBatchOutput(outputPath);  // Open the output target.
+    string text;                  // Output waiting to be written.
+
+    if (input) {                  // Apply each line of changes and report the result after it.
+        const char* lineStart = input->data;
+        const char* end = input->data + input->size;
+        while (lineStart < end) {
+            const char* lineEnd = lineStart;
+            while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+            try {
+                applyDeltaLine(evaluator, lineStart, lineEnd, definitions);
+                text += evaluator.result() ? "True\n" : "False\n";
+            } catch (exception& e) {  // Report errors inline so output lines stay aligned with input lines.
+                text += "Error: ";
+                text += e.what();
+                text += '\n';
+            }
+            if (text.size() >= (1 << 16)) {
+                fwrite(text.data(), 1, text.size(), out.get());
+                text.clear();
+            }
+            lineStart = lineEnd + 1;
+        }
+    } else {                      // Visit every assignment, flipping exactly one variable per step.
+        uint64_t rowCount = 1ULL << variableCount;
+        uint64_t satisfying = evaluator.result();
+        uint64_t totalUpdated = 0;
+        size_t mostUpdated = 0;
+        for (uint64_t step = 1; step < rowCount; ++step) {
+            satisfying += evaluator.toggle(__builtin_ctzll(step));  // Gray code flips the lowest set bit of the step.
+            totalUpdated += evaluator.lastUpdated();
+            mostUpdated = max(mostUpdated, evaluator.lastUpdated());
+        }
+        double average = rowCount > 1 ? static_cast<double>(totalUpdated) / (rowCount - 1) : 0.0;
+        char summary[256];
+        snprintf(summary, sizeof(summary),
+                 "Satisfying rows: %llu of %llu\nNodes: %zu, re-evaluated per step: %.1f on average, %zu at most\n",
+                 static_cast<unsigned long long>(satisfying), static_cast<unsigned long long>(rowCount),
+                 evaluator.nodeCount(), average, mostUpdated);
+        text += summary;
+    }
+
+    fwrite(text.data(), 1, text.size(), out.get());
+    closeBatchOutput(out, outputPath);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#ifndef INCREMENTALEVAL_H
+#define INCREMENTALEVAL_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "ExpressionDag.h"        // Include the user-defined header file that declares the node kinds.
+
+// Class that keeps the value of every subexpression and, when inputs change, re-evaluates only the nodes
+// on their fan-out, stopping wherever a node's value comes out the same. The cost of an update tracks the
+// part of the expression that actually changed rather than its size.
+class IncrementalEvaluator {
+public:
+    // Build the expression graph and evaluate it fully for a starting assignment.
+    explicit IncrementalEvaluator(const CompiledExpression& program, uint64_t assignment = 0);
+
+    bool result() const { return values[root]; }              // Value of the whole expression.
+    uint64_t assignment() const { return current; }           // Current assignment, bit i holding variable i.
+    bool assign(uint64_t assignment);                         // Move to a new assignment.
+    bool set(size_t variable, bool value);                    // Change one variable.
+    bool toggle(size_t variable);                             // Flip one variable.
+
+    size_t nodeCount() const { return ops.size(); }           // Nodes in the expression graph.
+    size_t lastUpdated() const { return updated; }            // Nodes re-evaluated by the last change.
+    const std::string& variables() const { return variableNames; }  // Variable names, indexed like the bits.
+
+private:
+    void propagate(uint64_t changed);  // Re-evaluate the fan-out of the changed variables.
+    bool compute(uint32_t node) const; // Value of a node from its operands.
+    void schedule(uint32_t node);      // Queue a node's parents for re-evaluation.
+
+    std::vector<uint8_t> ops;          // Kind of each node, children before parents.
+    std::vector<uint32_t> left;        // First operand of each node, or the variable index.
+    std::vector<uint32_t> right;       // Second operand of each node.
+    std::vector<uint8_t> values;       // Current value of each node.
+    std::vector<uint32_t> parentStart; // Start of each node's parents in the parent list.
+    std::vector<uint32_t> parents;     // Parents of every node, grouped by node.
+    std::vector<uint32_t> leaves;      // Node of each variable.
+    std::vector<uint8_t> queued;       // Whether each node is waiting to be re-evaluated.
+    std::vector<uint32_t> heap;        // Nodes waiting to be re-evaluated, smallest (deepest) first.
+    std::string variableNames;         // Variable names, indexed like the bits of an assignment.
+    uint32_t root = 0;                 // Node of the whole expression.
+    uint64_t current = 0;              // Current assignment.
+    size_t updated = 0;                // Nodes re-evaluated by the last change.
+};
+
+// Apply one line of changes, such as "A=1 !B C=0", as a single update. A line with an error throws before
+// anything is applied, so the evaluator keeps its assignment and result.
+void applyDeltaLine(IncrementalEvaluator& evaluator, const char* begin, const char* end,
+                    const BooleanDefinitions& definitions);
+
+// Evaluate an expression for a stream of input changes, one line of changes per result. Each change is
+// "A=1", "A=0" (or the true/false characters) to set a variable, or "!A" to flip it. Without a delta file,
+// sweep every assignment in Gray-code order and summarize. Returns the process exit code.
+int runIncremental(const std::string& expression, const std::string& deltaPath, const std::string& outputPath,
+                   const BooleanDefinitions& definitions);
+
+#endif // INCREMENTALEVAL_H
@@ -0,0 +1,210 @@
+/*
+ * Jit.cpp : Translates compiled expressions into native x86-64 code over bit-sliced words.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstring>                // Include the library for copying memory.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+#include "Jit.h"                  // Include the user-defined header file that declares the native backend.
+#if BOOLEANLOGIC_JIT
+#include <sys/mman.h>             // Include the POSIX library for executable mappings.
+#include <unistd.h>               // Include the POSIX library for the page size.
+#endif
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Constructor that translates the expression, keeping the bytecode for the interpreter in case that fails.
+JitExpression::JitExpression(const CompiledExpression& program) : code(program.code), stack(program.maxDepth) {
+    if (!translate()) function = nullptr;
+}
+
+// Destructor that releases the executable pages.
+JitExpression::~JitExpression() {
+#if BOOLEANLOGIC_JIT
+    if (pages) munmap(pages, pagesSize);
+#endif
+}
+
+// Function to run the bytecode on 64-bit bit-sliced words.
+uint64_t JitExpression::interpret(const uint64_t* variables) {
+    return runSlicedProgram(code.data(), code.size(), stack.data(), variables);
+}
+
+#if BOOLEANLOGIC_JIT
+
+// Registers holding the value stack, in order of use. rdi holds the variables pointer and rsp the stack,
+// and the last six are callee-saved, so they are pushed and popped when the expression needs them.
+static const uint8_t stackRegisters[] = {0 /* rax */, 1 /* rcx */, 2 /* rdx */, 6 /* rsi */, 8, 9, 10, 11,
+                                         3 /* rbx */, 5 /* rbp */, 12, 13, 14, 15};
+const size_t CALLER_SAVED_REGISTERS = 8;     // Registers the generated code may use without saving.
+static_assert(sizeof(stackRegisters) == JIT_STACK_REGISTERS, "Register list and limit must agree");
+
+// Class that appends x86-64 instructions to a buffer.
+class X86Emitter {
+public:
+    vector<uint8_t> bytes;        // Machine code emitted so far.
+
+    // Function to emit "op dst, src" for AND (0x21), OR (0x09) or XOR (0x31) on 64-bit registers.
+    void binary(uint8_t opcode, uint8_t dst, uint8_t src) {
+        bytes.push_back(static_cast<uint8_t>(0x48 | ((src >> 3) << 2) | (dst >> 3)));
+        bytes.push_back(opcode);
+        bytes.push_back(static_cast<uint8_t>(0xC0 | ((src & 7) << 3) | (dst & 7)));
+    }
+
+    // Function to emit "not dst".
+    void bitwiseNot(uint8_t dst) {
+        bytes.push_back(static_cast<uint8_t>(0x48 | (dst >> 3)));
+        bytes.push_back(0xF7);
+        bytes.push_back(static_cast<uint8_t>(0xD0 | (dst & 7)));
+    }
+
+    // Function to emit "mov dst, -1", setting every row true.
+    void allOnes(uint8_t dst) {
+        bytes.push_back(static_cast<uint8_t>(0x48 | (dst >> 3)));
+        bytes.push_back(0xC7);
+        bytes.push_back(static_cast<uint8_t>(0xC0 | (dst & 7)));
+        for (int i = 0; i < 4; ++i) bytes.push_back(0xFF);
+    }
+
+    // Function to emit "xor dst, dst", setting every row false.
+    void zero(uint8_t dst) { binary(0x31, dst, dst); }
+
+    // Function to emit "mov dst, [rdi + 8 * variable]".
+    void load(uint8_t dst, uint8_t variable) {
+        uint32_t offset = 8u * variable;
+        bytes.push_back(static_cast<uint8_t>(0x48 | ((dst >> 3) << 2)));
+        bytes.push_back(0x8B);
+        if (offset < 128) {       // Short displacement.
+            bytes.push_back(static_cast<uint8_t>(0x47 | ((dst & 7) << 3)));
+            bytes.push_back(static_cast<uint8_t>(offset));
+        } else {
+            bytes.push_back(static_cast<uint8_t>(0x87 | ((dst & 7) << 3)));
+            for (int i = 0; i < 4; ++i) bytes.push_back(static_cast<uint8_t>(offset >> (8 * i)));
+        }
+    }
+
+    // Function to emit "push reg" or "pop reg".
+    void push(uint8_t reg) { prefixed(0x50, reg); }
+    void pop(uint8_t reg) { prefixed(0x58, reg); }
+    void ret() { bytes.push_back(0xC3); }
+
+private:
+    void prefixed(uint8_t opcode, uint8_t reg) {
+        if (reg >= 8) bytes.push_back(0x41);
+        bytes.push_back(static_cast<uint8_t>(opcode | (reg & 7)));
+    }
+};
+
+// Function to generate machine code. The bytecode is rebuilt as a tree, each node is labelled with the
+// registers it needs (Sethi-Ullman numbering), and the tree is emitted deeper side first.
+bool JitExpression::translate() {
+    if (code.empty() || code.size() > JIT_MAX_INSTRUCTIONS) return false;
+
+    struct TreeNode {             // Define a structure for one operation of the expression tree.
+        uint8_t opcode;           // Member holding the bytecode instruction.
+        uint8_t variable;         // Member holding the variable a load reads.
+        uint32_t a, b;            // Members holding the operands.
+        uint32_t need;            // Member holding the registers needed to compute the node.
+    };
+    vector<TreeNode> tree;
+    vector<uint32_t> pending;     // Operands not yet consumed.
+    for (size_t i = 0; i < code.size(); ++i) {
+        TreeNode node{code[i], 0, 0, 0, 1};
+        if (node.opcode == OP_LOAD_VAR) {
+            node.variable = code[++i];
+        } else if (node.opcode == OP_NOT) {
+            node.a = pending.back();
+            pending.pop_back();
+            node.need = tree[node.a].need;
+        } else if (node.opcode != OP_PUSH_TRUE && node.opcode != OP_PUSH_FALSE) {
+            node.b = pending.back();
+            pending.pop_back();
+            node.a = pending.back();
+            pending.pop_back();
+            uint32_t x = tree[node.a].need, y = tree[node.b].need;
+            node.need = (x == y) ? x + 1 : max(x, y);
+        }
+        pending.push_back(static_cast<uint32_t>(tree.size()));
+        tree.push_back(node);
+    }
+    uint32_t root = pending.back();
+    size_t used = tree[root].need;
+    if (used > JIT_STACK_REGISTERS) return false;  // Too wide to keep in registers.
+
+    X86Emitter emit;
+    for (size_t r = CALLER_SAVED_REGISTERS; r < used; ++r) emit.push(stackRegisters[r]);
+
+    struct Frame {                // Define a structure for one pending step of the emission.
+        uint32_t node;            // Member holding the node being emitted.
+        uint8_t slot;             // Member holding the stack register that receives its value.
+        uint8_t stage;            // Member holding how many operands have been emitted.
+    };
+    vector<Frame> frames{{root, 0, 0}};
+    while (!frames.empty()) {
+        Frame& frame = frames.back();
+        const TreeNode& node = tree[frame.node];
+        uint8_t target = stackRegisters[frame.slot];
+        bool swapped = tree[node.b].need > tree[node.a].need;  // Emit the operand needing more registers first.
+        uint32_t first = swapped ? node.b : node.a, second = swapped ? node.a : node.b;
+        switch (node.opcode) {
+            case OP_PUSH_TRUE:  emit.allOnes(target); frames.pop_back(); break;
+            case OP_PUSH_FALSE: emit.zero(target); frames.pop_back(); break;
+            case OP_LOAD_VAR:   emit.load(target, node.variable); frames.pop_back(); break;
+            case OP_NOT:
+                if (frame.stage++ == 0) {
+                    frames.push_back({node.a, frame.slot, 0});
+                } else {
+                    emit.bitwiseNot(target);
+                    frames.pop_back();
+                }
+                break;
+            default:
+                if (frame.stage == 0) {
+                    frame.stage = 1;
+                    frames.push_back({first, frame.slot, 0});
+                } else if (frame.stage == 1) {
+                    frame.stage = 2;
+                    frames.push_back({second, static_cast<uint8_t>(frame.slot + 1), 0});
+                } else {
+                    uint8_t source = stackRegisters[frame.slot + 1];
+                    switch (node.opcode) {
+                        case OP_AND:  emit.binary(0x21, target, source); break;
+                        case OP_OR:   emit.binary(0x09, target, source); break;
+                        case OP_XOR:  emit.binary(0x31, target, source); break;
+                        case OP_NAND: emit.binary(0x21, target, source); emit.bitwiseNot(target); break;
+                    }
+                    frames.pop_back();
+                }
+        }
+    }
+
+    for (size_t r = used; r-- > CALLER_SAVED_REGISTERS;) emit.pop(stackRegisters[r]);
+    emit.ret();                   // The result is already in rax, the first stack register.
+
+    // Copy the code into fresh pages, then make them executable and read-only.
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    pagesSize = (emit.bytes.size() + pageSize - 1) / pageSize * pageSize;
+    void* mapping = mmap(nullptr, pagesSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) return false;
+    memcpy(mapping, emit.bytes.data(), emit.bytes.size());
+    if (mprotect(mapping, pagesSize, PROT_READ | PROT_EXEC) != 0) {
+        munmap(mapping, pagesSize);
+        return false;
+    }
+    pages = mapping;
+    codeSize = emit.bytes.size();
+    function = reinterpret_cast<Function>(mapping);
+    return true;
+}
+
+#else
+
+// Function used where no native backend exists, so every expression is interpreted.
+bool JitExpression::translate() {
+    return false;
+}
+
+#endif
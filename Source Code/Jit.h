@@ -0,0 +1,55 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+
+// The native backend needs x86-64 and POSIX executable mappings; everywhere else expressions are interpreted.
+#if defined(__x86_64__) && defined(__unix__) && !defined(BOOLEANLOGIC_NO_JIT)
+#define BOOLEANLOGIC_JIT 1
+#else
+#define BOOLEANLOGIC_JIT 0
+#endif
+
+const size_t JIT_MAX_INSTRUCTIONS = 1 << 22;  // Longest bytecode translated to machine code.
+const size_t JIT_STACK_REGISTERS = 14;        // Registers holding the value stack, the widest expression translated.
+
+// Class that translates a compiled expression into straight-line, branch-free x86-64 code working on 64-bit
+// bit-sliced words, so one call evaluates 64 rows. The value stack lives in registers, and operands are
+// reordered (every operator is commutative) so the deeper side is computed first and needs the fewest.
+// Expressions needing more registers than exist, or longer than JIT_MAX_INSTRUCTIONS, run on the interpreter.
+class JitExpression {
+public:
+    typedef uint64_t (*Function)(const uint64_t* variables);  // Signature of the generated code.
+
+    explicit JitExpression(const CompiledExpression& program);  // Translate, or prepare the interpreter.
+    ~JitExpression();             // Release the executable pages.
+
+    JitExpression(const JitExpression&) = delete;             // The pages are owned and must not be copied.
+    JitExpression& operator=(const JitExpression&) = delete;  // The pages are owned and must not be copied.
+
+    // Evaluate 64 rows at once, where variables[i] holds variable i's value in each of the 64 rows.
+    uint64_t evaluate(const uint64_t* variables) {
+        if (function) return function(variables);
+        return interpret(variables);
+    }
+
+    bool isNative() const { return function != nullptr; }  // Whether machine code is used.
+    size_t codeBytes() const { return codeSize; }          // Size of the generated machine code.
+    Function nativeFunction() const { return function; }   // Entry point of the machine code, or null.
+
+private:
+    uint64_t interpret(const uint64_t* variables);  // Run the bytecode on bit-sliced words.
+    bool translate();                               // Generate machine code, returning false to fall back.
+
+    std::vector<uint8_t> code;    // Bytecode, kept for the interpreter.
+    std::vector<uint64_t> stack;  // Stack of the interpreter.
+    Function function = nullptr;  // Entry point of the machine code, if any.
+    void* pages = nullptr;        // Executable mapping holding the machine code.
+    size_t pagesSize = 0;         // Size of the mapping.
+    size_t codeSize = 0;          // Bytes of machine code generated.
+};
+
+#endif // JIT_H
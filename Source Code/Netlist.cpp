@@ -0,0 +1,295 @@
+/*
+ * Netlist.cpp : Loads combinational circuits and simulates stimulus files many vectors per word on all cores.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdio>                 // Include the library for buffered C file output.
+#include <sstream>                // Include the library for splitting lines into words.
+#include <unordered_map>          // Include the library for the hash map container.
+#include <algorithm>              // Include the library for sorting.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "BatchInput.h"           // Include the user-defined header file that declares the input mapping.
+#include "Netlist.h"              // Include the user-defined header file that declares the netlist simulator.
+#include "TruthTableSlices.h"     // Include the user-defined header file that declares the row slices.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to throw an error that points at a line of the netlist.
+[[noreturn]] static void netlistError(size_t line, const string& message) {
+    throw runtime_error("Netlist line " + to_string(line) + ": " + message);
+}
+
+// Constructor that parses a netlist, reduces every gate to two inputs, then sorts the gates by level and kind.
+// Each line is "INPUT names...", "OUTPUT names..." or "name = GATE inputs...", where GATE is AND, OR, NAND,
+// XOR, NOT or BUF. Parentheses and commas may separate the inputs, and '#' starts a comment.
+Netlist::Netlist(istream& in) {
+    struct NamedGate {            // Define a structure for a gate as written in the file.
+        string name;              // Member holding the wire the gate drives.
+        GateOp op;                // Member holding the kind of gate.
+        vector<string> inputs;    // Member holding the wires the gate reads.
+        size_t line;              // Member holding the line the gate was declared on.
+    };
+    vector<NamedGate> named;
+    vector<size_t> inputLines;             // Lines declaring each input.
+    vector<pair<string, size_t>> outputs;  // Output names and the lines declaring them.
+    unordered_map<string, uint32_t> ids;   // Node of every declared wire.
+
+    string text;
+    for (size_t line = 1; getline(in, text); ++line) {
+        text = text.substr(0, text.find('#'));   // Drop comments.
+        for (char& c : text) {
+            if (c == '(' || c == ')' || c == ',') c = ' ';
+        }
+        stringstream words(text);
+        string first;
+        if (!(words >> first)) continue;         // Skip blank lines.
+        string word;
+        if (first == "INPUT") {
+            while (words >> word) {
+                inputNames.push_back(word);
+                inputLines.push_back(line);
+            }
+        } else if (first == "OUTPUT") {
+            while (words >> word) outputs.emplace_back(word, line);
+        } else {
+            string equals, kind;
+            if (!(words >> equals >> kind) || equals != "=") netlistError(line, "Expected: name = GATE inputs");
+            NamedGate gate{first, GATE_AND, {}, line};
+            if (kind == "AND") gate.op = GATE_AND;
+            else if (kind == "OR") gate.op = GATE_OR;
+            else if (kind == "NAND") gate.op = GATE_NAND;
+            else if (kind == "XOR") gate.op = GATE_XOR;
+            else if (kind == "NOT") gate.op = GATE_NOT;
+            else if (kind == "BUF") gate.op = GATE_BUF;
+            else netlistError(line, "Unknown gate: " + kind);
+            while (words >> word) gate.inputs.push_back(word);
+            bool unary = (gate.op == GATE_NOT || gate.op == GATE_BUF);
+            if (unary ? gate.inputs.size() != 1 : gate.inputs.size() < 2) {
+                netlistError(line, kind + (unary ? " takes one input" : " takes at least two inputs"));
+            }
+            named.push_back(move(gate));
+        }
+    }
+    if (outputs.empty()) throw runtime_error("Netlist declares no outputs");
+
+    // Number the wires: inputs first, then the named gates in file order.
+    for (size_t i = 0; i < inputNames.size(); ++i) {
+        if (!ids.emplace(inputNames[i], static_cast<uint32_t>(i)).second) {
+            netlistError(inputLines[i], "Wire declared twice: " + inputNames[i]);
+        }
+    }
+    for (size_t j = 0; j < named.size(); ++j) {
+        if (!ids.emplace(named[j].name, static_cast<uint32_t>(inputNames.size() + j)).second) {
+            netlistError(named[j].line, "Wire declared twice: " + named[j].name);
+        }
+    }
+
+    // Reduce every gate to two-input gates. Named gate j keeps node inputCount + j, and the balanced trees
+    // that wider gates become are given nodes after all the named ones.
+    uint32_t inputs = static_cast<uint32_t>(inputNames.size());
+    vector<uint8_t> nodeOp(named.size());
+    vector<uint32_t> nodeLeft(named.size()), nodeRight(named.size());
+    for (size_t j = 0; j < named.size(); ++j) {
+        vector<uint32_t> fanin;
+        for (const string& name : named[j].inputs) {
+            auto found = ids.find(name);
+            if (found == ids.end()) netlistError(named[j].line, "Undeclared wire: " + name);
+            fanin.push_back(found->second);
+        }
+        GateOp op = named[j].op;
+        GateOp treeOp = (op == GATE_NAND) ? GATE_AND : op;  // A wide NAND is an AND tree with a NAND on top.
+        while (fanin.size() > 2) {
+            vector<uint32_t> paired;
+            for (size_t k = 0; k + 1 < fanin.size(); k += 2) {
+                paired.push_back(inputs + static_cast<uint32_t>(nodeOp.size()));
+                nodeOp.push_back(treeOp);
+                nodeLeft.push_back(fanin[k]);
+                nodeRight.push_back(fanin[k + 1]);
+            }
+            if (fanin.size() % 2) paired.push_back(fanin.back());
+            fanin.swap(paired);
+        }
+        nodeOp[j] = op;
+        nodeLeft[j] = fanin[0];
+        nodeRight[j] = fanin.size() > 1 ? fanin[1] : fanin[0];
+    }
+
+    // Levelize with Kahn's algorithm: a gate's level is one more than the deepest gate it reads.
+    size_t nodeCount = nodeOp.size();
+    vector<uint32_t> pending(nodeCount, 0);        // Number of gate inputs not yet levelized.
+    vector<uint32_t> fanoutStart(nodeCount + 1, 0);
+    for (size_t g = 0; g < nodeCount; ++g) {
+        for (uint32_t wire : {nodeLeft[g], nodeRight[g]}) {
+            if (wire >= inputs) {
+                ++pending[g];
+                ++fanoutStart[wire - inputs + 1];
+            }
+        }
+    }
+    for (size_t g = 0; g < nodeCount; ++g) fanoutStart[g + 1] += fanoutStart[g];
+    vector<uint32_t> fanout(fanoutStart[nodeCount]);
+    vector<uint32_t> fill(fanoutStart.begin(), fanoutStart.end() - 1);
+    for (size_t g = 0; g < nodeCount; ++g) {
+        for (uint32_t wire : {nodeLeft[g], nodeRight[g]}) {
+            if (wire >= inputs) fanout[fill[wire - inputs]++] = static_cast<uint32_t>(g);
+        }
+    }
+    vector<uint32_t> level(nodeCount, 1);
+    vector<uint32_t> ready;
+    for (size_t g = 0; g < nodeCount; ++g) {
+        if (pending[g] == 0) ready.push_back(static_cast<uint32_t>(g));
+    }
+    size_t levelized = 0;
+    while (!ready.empty()) {
+        uint32_t g = ready.back();
+        ready.pop_back();
+        ++levelized;
+        levels = max<size_t>(levels, level[g]);
+        for (uint32_t k = fanoutStart[g]; k < fanoutStart[g + 1]; ++k) {
+            uint32_t next = fanout[k];
+            level[next] = max(level[next], level[g] + 1);
+            if (--pending[next] == 0) ready.push_back(next);
+        }
+    }
+    if (levelized != nodeCount) {  // Whatever is left sits on or behind a loop.
+        for (size_t j = 0; j < named.size(); ++j) {
+            if (pending[j] != 0) netlistError(named[j].line, "Combinational loop through " + named[j].name);
+        }
+        throw runtime_error("Netlist contains a combinational loop");
+    }
+
+    // Lay the gates out by level, then by kind, and renumber the wires to match.
+    vector<uint32_t> order(nodeCount);
+    for (size_t g = 0; g < nodeCount; ++g) order[g] = static_cast<uint32_t>(g);
+    stable_sort(order.begin(), order.end(), [&](uint32_t x, uint32_t y) {
+        return level[x] != level[y] ? level[x] < level[y] : nodeOp[x] < nodeOp[y];
+    });
+    vector<uint32_t> position(nodeCount);
+    for (size_t k = 0; k < nodeCount; ++k) position[order[k]] = static_cast<uint32_t>(k);
+    auto wireOf = [&](uint32_t node) { return node < inputs ? node : inputs + position[node - inputs]; };
+    ops.resize(nodeCount);
+    left.resize(nodeCount);
+    right.resize(nodeCount);
+    for (size_t k = 0; k < nodeCount; ++k) {
+        uint32_t g = order[k];
+        ops[k] = nodeOp[g];
+        left[k] = wireOf(nodeLeft[g]);
+        right[k] = wireOf(nodeRight[g]);
+        if (runs.empty() || runs.back().op != ops[k] || level[order[runs.back().begin]] != level[g]) {
+            runs.push_back({static_cast<GateOp>(ops[k]), static_cast<uint32_t>(k), static_cast<uint32_t>(k)});
+        }
+        runs.back().end = static_cast<uint32_t>(k + 1);
+    }
+
+    for (const auto& output : outputs) {
+        auto found = ids.find(output.first);
+        if (found == ids.end()) netlistError(output.second, "Undeclared output: " + output.first);
+        outputNames.push_back(output.first);
+        outputWires.push_back(wireOf(found->second));
+    }
+}
+
+// Class that packs stimulus vectors into the lanes of a slice, simulates them together and unpacks the outputs.
+class StimulusRunner {
+public:
+    explicit StimulusRunner(const Netlist& netlist) : netlist(netlist), wires(netlist.wireCount()) {}
+
+    // Function to simulate every vector of a chunk, writing one output line per input line. Malformed
+    // vectors produce an error line, and blank lines and comments an empty line, so output stays aligned with input.
+    // Returns the number of vectors simulated.
+    uint64_t run(const LineRange& chunk, string& output) {
+        simulated = 0;
+        const char* lineStart = chunk.begin;
+        while (lineStart < chunk.end) {
+            const char* lineEnd = lineStart;
+            while (lineEnd < chunk.end && *lineEnd != '\n') ++lineEnd;
+            add(lineStart, lineEnd, output);
+            lineStart = lineEnd + 1;
+        }
+        flush(output);
+        return simulated;
+    }
+
+private:
+    // Function to load one vector into the next free lane, or queue an error or empty line for it.
+    void add(const char* begin, const char* end, string& output) {
+        const char* first = begin;  // Skip the whitespace a vector may contain, so indented lines are recognized.
+        while (first < end && (*first == ' ' || *first == '\t' || *first == '\r')) ++first;
+        if (first == end || *first == '#') {  // Keep blank lines and comments as empty lines.
+            entries.push_back(-1 - static_cast<int64_t>(errors.size()));
+            errors.push_back(nullptr);
+            return;
+        }
+        if (lanes == 0) {
+            for (size_t i = 0; i < netlist.inputCount(); ++i) wires[i] = RowSlice{};
+        }
+        size_t input = 0;
+        const char* error = nullptr;
+        uint64_t bit = 1ULL << (lanes % 64);
+        for (const char* p = begin; p < end && !error; ++p) {
+            if (*p == ' ' || *p == '\t' || *p == '\r' || *p == '_') continue;
+            if (*p != '0' && *p != '1') error = "Stimulus values must be 0 or 1";
+            else if (input == netlist.inputCount()) error = "Too many values in stimulus vector";
+            else {
+                if (*p == '1') wires[input][lanes / 64] |= bit;
+                ++input;
+            }
+        }
+        if (!error && input != netlist.inputCount()) error = "Too few values in stimulus vector";
+        if (error) {              // Undo the partly loaded lane and remember where the error goes.
+            for (size_t i = 0; i < input; ++i) wires[i][lanes / 64] &= ~bit;
+            entries.push_back(-1 - static_cast<int64_t>(errors.size()));
+            errors.push_back(error);
+        } else {
+            entries.push_back(static_cast<int64_t>(lanes++));
+        }
+        if (lanes == SLICE_ROWS) flush(output);
+    }
+
+    // Function to simulate the loaded lanes and write their outputs and any queued errors in order.
+    void flush(string& output) {
+        if (lanes > 0) netlist.simulate(wires.data());
+        for (int64_t entry : entries) {
+            if (entry < 0) {
+                if (const char* error = errors[-1 - entry]) {
+                    output += "Error: ";
+                    output += error;
+                }
+            } else {
+                for (size_t o = 0; o < netlist.outputCount(); ++o) {
+                    output += ((wires[netlist.outputWire(o)][entry / 64] >> (entry % 64)) & 1) ? '1' : '0';
+                }
+            }
+            output += '\n';
+        }
+        simulated += lanes;
+        lanes = 0;
+        entries.clear();
+        errors.clear();
+    }
+
+    const Netlist& netlist;       // Circuit being simulated.
+    vector<RowSlice> wires;       // Value of every wire in every lane.
+    size_t lanes = 0;             // Number of lanes loaded so far.
+    uint64_t simulated = 0;       // Number of vectors simulated in the current chunk.
+    vector<int64_t> entries;      // Lane of each queued line, or -1 - index of its error.
+    vector<const char*> errors;   // Errors of the queued lines, or null for a blank line.
+};
+
+// Function to run every vector of a stimulus file through the circuit and write the outputs in input order.
+uint64_t runStimulus(const Netlist& netlist, const string& inputPath, const string& outputPath, unsigned threadCount) {
+    BatchInput input(inputPath);  // Map or read the whole stimulus before touching the output.
+    BatchOutput out = openBatchOutput(outputPath);  // Open the output target.
+
+    // Each worker owns its wire values, so lanes are packed without sharing.
+    uint64_t vectors = runOrderedChunks(input.data, input.size, threadCount, [&]() {
+        return [runner = StimulusRunner(netlist)](const LineRange& chunk, string& output) mutable {
+            return runner.run(chunk, output);
+        };
+    }, out.get());
+    closeBatchOutput(out, outputPath);
+    return vectors;
+}
@@ -0,0 +1,77 @@
+#ifndef NETLIST_H
+#define NETLIST_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <istream>                // Include the library for input streams.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "TruthTable.h"           // Include the user-defined header file that declares the word-wide gates.
+
+enum GateOp : uint8_t {           // Define an enumeration of the two-input gates a circuit is reduced to.
+    GATE_AND,                     // Enumerator for the AND gate.
+    GATE_OR,                      // Enumerator for the OR gate.
+    GATE_NAND,                    // Enumerator for the NAND gate.
+    GATE_XOR,                     // Enumerator for the XOR gate.
+    GATE_NOT,                     // Enumerator for the NOT gate, which reads only its left input.
+    GATE_BUF                      // Enumerator for a buffer, which copies its left input.
+};
+
+// Class that holds a combinational circuit as struct-of-arrays gate tables sorted by level, so every gate's
+// inputs are computed before it and gates of the same level and kind are evaluated in one tight loop.
+// Wires 0..inputCount()-1 are the primary inputs; gate g drives wire inputCount() + g.
+class Netlist {
+public:
+    explicit Netlist(std::istream& in);  // Parse, levelize and lay out a netlist.
+
+    size_t inputCount() const { return inputNames.size(); }     // Number of primary inputs.
+    size_t outputCount() const { return outputNames.size(); }   // Number of primary outputs.
+    size_t gateCount() const { return ops.size(); }             // Number of two-input gates after reduction.
+    size_t wireCount() const { return inputCount() + gateCount(); }  // Number of wires a simulation needs.
+    size_t levelCount() const { return levels; }                // Number of gate levels.
+    uint32_t outputWire(size_t output) const { return outputWires[output]; }  // Wire driving an output.
+
+    // Compute every gate's wire from the input wires already stored in wires[0..inputCount()-1].
+    template <typename Word> void simulate(Word* wires) const;
+
+    std::vector<std::string> inputNames;   // Names of the primary inputs in declaration order.
+    std::vector<std::string> outputNames;  // Names of the primary outputs in declaration order.
+
+private:
+    struct GateRun {              // Define a structure for consecutive gates of one level and kind.
+        GateOp op;                // Member holding the kind of every gate in the run.
+        uint32_t begin;           // Member holding the first gate of the run.
+        uint32_t end;             // Member holding one past the last gate of the run.
+    };
+
+    std::vector<uint8_t> ops;     // Kind of each gate.
+    std::vector<uint32_t> left;   // Wire read by each gate as its first input.
+    std::vector<uint32_t> right;  // Wire read by each gate as its second input.
+    std::vector<GateRun> runs;    // Gates grouped by level and kind, in evaluation order.
+    std::vector<uint32_t> outputWires;  // Wire driving each primary output.
+    size_t levels = 0;            // Number of gate levels.
+};
+
+template <typename Word>
+void Netlist::simulate(Word* wires) const {
+    Word* out = wires + inputCount();  // Wires driven by gates.
+    const uint32_t* a = left.data();
+    const uint32_t* b = right.data();
+    for (const GateRun& run : runs) {
+        switch (run.op) {
+            case GATE_AND:  for (uint32_t g = run.begin; g < run.end; ++g) out[g] = sliceAND(wires[a[g]], wires[b[g]]); break;
+            case GATE_OR:   for (uint32_t g = run.begin; g < run.end; ++g) out[g] = sliceOR(wires[a[g]], wires[b[g]]); break;
+            case GATE_NAND: for (uint32_t g = run.begin; g < run.end; ++g) out[g] = sliceNAND(wires[a[g]], wires[b[g]]); break;
+            case GATE_XOR:  for (uint32_t g = run.begin; g < run.end; ++g) out[g] = sliceXOR(wires[a[g]], wires[b[g]]); break;
+            case GATE_NOT:  for (uint32_t g = run.begin; g < run.end; ++g) out[g] = sliceNOT(wires[a[g]]); break;
+            case GATE_BUF:  for (uint32_t g = run.begin; g < run.end; ++g) out[g] = wires[a[g]]; break;
+        }
+    }
+}
+
+// Run every vector of a stimulus file through the circuit on all cores and write the outputs in input order,
+// one line per input line. Returns the number of vectors simulated.
+uint64_t runStimulus(const Netlist& netlist, const std::string& inputPath, const std::string& outputPath,
+                     unsigned threadCount);
+
+#endif // NETLIST_H
@@ -0,0 +1,199 @@
+/*
+ * ParallelTruthTable.cpp : Enumerates large truth tables on all cores and streams them out in row order.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <vector>                 // Include the library for the dynamic array container.
+#include <memory>                 // Include the library for owning pointers.
+#include <thread>                 // Include the library for launching worker threads.
+#include <mutex>                  // Include the library for mutual exclusion.
+#include <condition_variable>     // Include the library for waiting on other threads.
+#include <algorithm>              // Include the library for min and max.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "TruthTable.h"           // Include the user-defined header file that declares the truth table functions.
+#include "TruthTableSlices.h"     // Include the user-defined header file that declares the row slices.
+#include "ParallelTruthTable.h"   // Include the user-defined header file that declares the parallel truth table.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+const uint64_t BLOCK_SLICES = 32;       // Number of row slices evaluated as one unit of work.
+const uint64_t SEGMENT_BLOCKS = 4;      // Number of blocks a worker takes from the shared cursor at once.
+const uint64_t WINDOW_PER_WORKER = 16;  // Number of blocks per worker allowed ahead of the writer.
+
+// Class that hands out blocks of rows to workers, each of which steals from the others when it runs dry.
+// Only blocks inside a window just ahead of the writer are handed out, which bounds buffered output.
+class BlockScheduler {
+public:
+    // Constructor that sets up one empty range per worker.
+    BlockScheduler(uint64_t blockCount, unsigned workerCount, uint64_t window)
+        : blockCount(blockCount), windowEnd(window) {
+        for (unsigned i = 0; i < workerCount; ++i) ranges.emplace_back(new WorkerRange());
+    }
+
+    // Function to claim the next block for a worker, returning false once no work is left for it.
+    bool claim(unsigned worker, uint64_t& block) {
+        while (true) {
+            WorkerRange& own = *ranges[worker];
+            {
+                lock_guard<mutex> lock(own.lock);
+                if (own.front < own.back) {     // Take the lowest block of the worker's own range.
+                    block = own.front++;
+                    return true;
+                }
+            }
+            if (steal(worker)) continue;        // Take over half of another worker's range.
+
+            unique_lock<mutex> gateLock(gateMutex);
+            if (cursor >= blockCount) return false;  // Everything has been handed out.
+            if (cursor < windowEnd) {           // Take a fresh segment that still fits in the window.
+                uint64_t end = min({cursor + SEGMENT_BLOCKS, windowEnd, blockCount});
+                uint64_t begin = cursor;
+                cursor = end;
+                gateLock.unlock();
+                lock_guard<mutex> lock(own.lock);
+                own.front = begin;
+                own.back = end;
+                continue;
+            }
+            gate.wait(gateLock);                // Wait until the writer moves the window forward.
+        }
+    }
+
+    // Function called by the writer to let blocks below flushed + window be handed out.
+    void advance(uint64_t flushed, uint64_t window) {
+        {
+            lock_guard<mutex> gateLock(gateMutex);
+            windowEnd = flushed + window;
+        }
+        gate.notify_all();
+    }
+
+private:
+    struct WorkerRange {          // Define a structure for the contiguous blocks one worker still owns.
+        mutex lock;               // Member guarding the range against thieves.
+        uint64_t front = 0;       // Member holding the next block the owner will take.
+        uint64_t back = 0;        // Member holding one past the last block in the range.
+    };
+
+    // Function to move the upper half of the first non-empty victim range into the thief's range.
+    bool steal(unsigned thief) {
+        for (size_t offset = 1; offset < ranges.size(); ++offset) {
+            WorkerRange& victim = *ranges[(thief + offset) % ranges.size()];
+            uint64_t begin, end;
+            {
+                lock_guard<mutex> lock(victim.lock);
+                if (victim.front >= victim.back) continue;
+                begin = victim.front + (victim.back - victim.front) / 2;  // Leave the lower half to the owner.
+                end = victim.back;
+                victim.back = begin;
+            }
+            lock_guard<mutex> lock(ranges[thief]->lock);
+            ranges[thief]->front = begin;
+            ranges[thief]->back = end;
+            return true;
+        }
+        return false;
+    }
+
+    vector<unique_ptr<WorkerRange>> ranges;  // Ranges owned by each worker.
+    uint64_t blockCount;                     // Number of blocks in the table.
+    uint64_t cursor = 0;                     // First block not yet given to any worker.
+    uint64_t windowEnd;                      // First block that may not be handed out yet.
+    mutex gateMutex;                         // Mutex guarding the cursor and the window.
+    condition_variable gate;                 // Signal raised when the window moves.
+};
+
+// Structure holding the result of one block until the writer reaches it.
+struct BlockSlot {
+    string text;                  // Formatted rows of the block.
+    uint64_t count = 0;           // Number of true rows in the block.
+    bool ready = false;           // Whether the block has been filled in.
+};
+
+// Function to enumerate every assignment of an expression's variables, writing rows in order to the stream.
+// Returns the number of assignments that make the expression true.
+uint64_t printExpressionTruthTable(const string& expression, const BooleanDefinitions& definitions, TableMode mode,
+                                   ostream& out, unsigned threadCount) {
+    CompiledExpression program = compileExpression(expression, definitions, true);  // Parse once, allowing variables.
+    size_t variableCount = program.variables.size();
+    if (variableCount > 62) throw runtime_error("Too many variables for a truth table");
+    uint64_t rowCount = 1ULL << variableCount;                       // Number of assignments to enumerate.
+    uint64_t blockRows = SLICE_ROWS * BLOCK_SLICES;                  // Number of rows in one block.
+    uint64_t blockCount = (rowCount + blockRows - 1) / blockRows;
+
+    if (threadCount == 0) threadCount = thread::hardware_concurrency();
+    threadCount = static_cast<unsigned>(max<uint64_t>(1, min<uint64_t>(threadCount, blockCount)));
+    uint64_t window = WINDOW_PER_WORKER * threadCount;               // Blocks allowed in flight.
+
+    if (mode != TABLE_COUNT_ONLY) {   // Print headers for the truth table columns.
+        string header;
+        for (char name : program.variables) {
+            header += name;
+            header += ' ';
+        }
+        header += "| Result\n";
+        out.write(header.data(), header.size());
+    }
+
+    BlockScheduler scheduler(blockCount, threadCount, window);
+    vector<BlockSlot> slots(window);  // Ring of results indexed by block number modulo the window.
+    mutex slotMutex;                  // Mutex guarding the ready flags.
+    condition_variable slotReady;     // Signal raised when a block is filled in.
+
+    // Worker loop that evaluates and formats blocks into its own buffer, then hands the buffer to the writer.
+    auto worker = [&](unsigned id) {
+        vector<RowSlice> stack(program.maxDepth);     // Evaluation stack reused for every slice.
+        vector<RowSlice> variables(variableCount);    // Variable columns for the current slice.
+        string local;                                 // Thread-local output buffer.
+        uint64_t block;
+        while (scheduler.claim(id, block)) {
+            uint64_t count = 0;
+            local.clear();
+            uint64_t blockEnd = min(rowCount, (block + 1) * blockRows);
+            for (uint64_t firstRow = block * blockRows; firstRow < blockEnd; firstRow += SLICE_ROWS) {
+                loadVariableSlices(variableCount, firstRow, variables.data());
+                RowSlice results = runSlicedProgram(program.code.data(), program.code.size(), stack.data(), variables.data());
+                count += countRowSlice(results, firstRow, rowCount);
+                if (mode != TABLE_COUNT_ONLY) {
+                    formatRowSlice(results, firstRow, rowCount, variableCount, mode == TABLE_SATISFYING_ROWS, local);
+                }
+            }
+            BlockSlot& slot = slots[block % window];
+            slot.text.swap(local);                    // Trade buffers so the writer's old one is reused here.
+            slot.count = count;
+            {
+                lock_guard<mutex> lock(slotMutex);
+                slot.ready = true;
+            }
+            slotReady.notify_all();
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned i = 0; i < threadCount; ++i) workers.emplace_back(worker, i);
+
+    // Write the blocks in row order, moving the window forward as each one is flushed.
+    uint64_t satisfying = 0;
+    for (uint64_t block = 0; block < blockCount; ++block) {
+        BlockSlot& slot = slots[block % window];
+        {
+            unique_lock<mutex> lock(slotMutex);
+            slotReady.wait(lock, [&]() { return slot.ready; });
+        }
+        out.write(slot.text.data(), slot.text.size());
+        satisfying += slot.count;
+        slot.text.clear();            // Keep the capacity so a worker can reuse the buffer.
+        {
+            lock_guard<mutex> lock(slotMutex);
+            slot.ready = false;
+        }
+        scheduler.advance(block + 1, window);
+    }
+    for (thread& t : workers) t.join();
+
+    out << "Satisfying rows: " << satisfying << " of " << rowCount << endl;
+    return satisfying;
+}
@@ -0,0 +1,20 @@
+#ifndef PARALLELTRUTHTABLE_H
+#define PARALLELTRUTHTABLE_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <iostream>               // Include the library for input and output streaming.
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+enum TableMode {                  // Define an enumeration of what a truth table run produces.
+    TABLE_ALL_ROWS,               // Print every row.
+    TABLE_SATISFYING_ROWS,        // Print only the rows where the expression is true.
+    TABLE_COUNT_ONLY              // Print nothing but the number of true rows.
+};
+
+// Enumerate every assignment of an expression's variables on all cores, writing rows in order to the stream.
+// Returns the number of assignments that make the expression true.
+uint64_t printExpressionTruthTable(const std::string& expression, const BooleanDefinitions& definitions,
+                                   TableMode mode = TABLE_ALL_ROWS, std::ostream& out = std::cout, unsigned threadCount = 0);
+
+#endif // PARALLELTRUTHTABLE_H
@@ -0,0 +1,68 @@
+/*
+ * ParseCache.cpp : Bounded LRU cache of parsed expressions keyed on their normalized text.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cctype>                 // Include the library for character classification functions.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
+#include "ParseCache.h"           // Include the user-defined header file that declares the parse cache.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to return the postfix form of an expression, running shuntingYard only on a miss.
+// Invalid expressions are never cached, so they report the same errors as shuntingYard every time.
+string ParseCache::postfix(const string& expression, const BooleanDefinitions& definitions) {
+    if (definitions.trueDef != cachedDefinitions.trueDef || definitions.falseDef != cachedDefinitions.falseDef) {
+        if (!entries.empty()) ++counters.invalidations;  // The literals changed since the entries were parsed.
+        clear();
+        cachedDefinitions = definitions;
+    }
+
+    string key = normalize(expression);
+
+    auto found = index.find(key);
+    if (found != index.end()) {                // Move the entry to the front as the most recently used.
+        ++counters.hits;
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->second;
+    }
+
+    ++counters.misses;
+    string result = shuntingYard(expression, definitions);  // Throws before anything is cached if the expression is invalid.
+    if (entries.size() >= capacity) {          // Drop the least recently used entry to make room.
+        index.erase(entries.back().first);
+        entries.pop_back();
+        ++counters.evictions;
+    }
+    entries.emplace_front(key, result);
+    index[entries.front().first] = entries.begin();
+    return result;
+}
+
+// Function to drop every cached expression.
+void ParseCache::clear() {
+    entries.clear();
+    index.clear();
+}
+
+// Function to return the counters and current occupancy.
+ParseCacheStats ParseCache::stats() const {
+    ParseCacheStats result = counters;
+    result.size = entries.size();
+    result.capacity = capacity;
+    return result;
+}
+
+// Function to strip whitespace, so the key does not depend on spacing. The literals are kept as written, since
+// the cache is flushed whenever the true and false definitions change.
+string ParseCache::normalize(const string& expression) const {
+    string key;
+    key.reserve(expression.size());
+    for (char c : expression) {
+        if (!isspace(static_cast<unsigned char>(c))) key += c;
+    }
+    return key;
+}
@@ -0,0 +1,44 @@
+#ifndef PARSECACHE_H
+#define PARSECACHE_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include <list>                   // Include the library for the linked list container.
+#include <unordered_map>          // Include the library for the hash map container.
+#include <utility>                // Include the library for pairs.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+struct ParseCacheStats {          // Define a structure to report how well the cache is working.
+    uint64_t hits = 0;            // Member counting lookups answered from the cache.
+    uint64_t misses = 0;          // Member counting lookups that had to parse.
+    uint64_t evictions = 0;       // Member counting entries dropped to make room.
+    uint64_t invalidations = 0;   // Member counting flushes caused by new true/false definitions.
+    size_t size = 0;              // Member holding the number of cached expressions.
+    size_t capacity = 0;          // Member holding the most expressions the cache will hold.
+};
+
+// Class that remembers the postfix form of recently parsed expressions, dropping the least recently used first.
+// The cache is not thread-safe; give each thread its own.
+class ParseCache {
+public:
+    // Constructor that sets how many expressions the cache may hold.
+    explicit ParseCache(size_t capacity = 1024) : capacity(capacity > 0 ? capacity : 1) {}
+
+    // Return the postfix form of an expression, running shuntingYard only on a miss.
+    std::string postfix(const std::string& expression, const BooleanDefinitions& definitions);
+
+    void clear();                 // Drop every cached expression.
+    ParseCacheStats stats() const;  // Return the counters and current occupancy.
+
+private:
+    std::string normalize(const std::string& expression) const;  // Build the cache key.
+
+    size_t capacity;                                   // Most expressions the cache will hold.
+    std::list<std::pair<std::string, std::string>> entries;  // Normalized text and postfix, most recent first.
+    std::unordered_map<std::string, std::list<std::pair<std::string, std::string>>::iterator> index;  // Entry for each key.
+    BooleanDefinitions cachedDefinitions;              // Definitions the entries were parsed with.
+    ParseCacheStats counters;                          // Running counters.
+};
+
+#endif // PARSECACHE_H
@@ -0,0 +1,59 @@
+/*
+ * PostfixEval.cpp : Evaluates postfix expressions produced by the shunting yard algorithm.
+ *
+ * 2024 ©Macrosoft
+ *
+ * Authors:
+ *   - Ahmad Awan
+ *   - Mario Simental
+ *   - Sulitan Subade
+ *   - Karsten Wolter
+ *   - Jack Pigott
+ *
+ * Creation Date: April 24, 2024
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <stack>                  // Include the library for using stack data structures.
+#include <string>                 // Include the library for string manipulation.
+#include "FileParse.h"            // Include the user-defined header file that declares the parsing functions.
+#include "PostfixEval.h"          // Include the user-defined header file that declares the postfix evaluator.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to evaluate a postfix expression consisting of boolean values.
+bool evalPostfix(const string& postfix, const BooleanDefinitions& definitions) {
+    stack<bool> evalStack;        // Stack to hold boolean values during evaluation.
+
+    // Iterate over each character in the postfix expression.
+    for (char c : postfix) {
+        // Check if character is a boolean literal 'T' or 'F'.
+        if (c == definitions.trueDef || c == definitions.falseDef) {
+            evalStack.push(c == definitions.trueDef);  // Push true for 'T', false for 'F'.
+        } else if (isOperator(c)) {   // Check if character is an operator.
+            if (c == '!') {           // Specifically check for the NOT operator.
+                if (evalStack.empty()) throw runtime_error("Missing operand for NOT operation");
+                bool val = evalStack.top(); // Retrieve the top value from stack.
+                evalStack.pop();            // Remove the top value.
+                evalStack.push(!val);       // Push the negated value back onto the stack.
+            } else { // Handling for binary operators (AND, OR, NAND, XOR).
+                if (evalStack.size() < 2) throw runtime_error("Missing operand for binary operator");
+                bool val1 = evalStack.top(); // Right operand.
+                evalStack.pop();             // Remove the right operand.
+                bool val2 = evalStack.top(); // Left operand.
+                evalStack.pop();             // Remove the left operand.
+                // Perform operation based on the operator and push the result.
+                switch (c) {
+                    case '&': evalStack.push(val2 && val1); break;  // AND operation.
+                    case '|': evalStack.push(val2 || val1); break;  // OR operation.
+                    case '@': evalStack.push(!(val2 && val1)); break; // NAND operation.
+                    case '$': evalStack.push(val2 != val1); break;   // XOR operation.
+                }
+            }
+        }
+    }
+    if (evalStack.empty()) throw runtime_error("No operands or operators present");  // Error if nothing was pushed, as for "()".
+    return evalStack.top();        // Return the result of the evaluated expression.
+}
@@ -0,0 +1,9 @@
+#ifndef POSTFIXEVAL_H
+#define POSTFIXEVAL_H
+
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+bool evalPostfix(const std::string& postfix, const BooleanDefinitions& definitions);  // Evaluate a postfix expression.
+
+#endif // POSTFIXEVAL_H
@@ -0,0 +1,252 @@
+#ifndef STATICEXPRESSION_H
+#define STATICEXPRESSION_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include "Bytecode.h"             // Include the user-defined header file that declares the opcodes.
+#include "FileParse.h"            // Include the user-defined header file that defines the operator precedence.
+
+// Compile-time counterpart of shuntingYard and compilePostfix for expressions fixed in the source, such as
+// rules and policies. compileStatic parses a string literal into an expression tree during compilation, using
+// the same operators, precedence and associativity as the runtime parser, and StaticExpression turns that tree
+// into nested inline calls, so an evaluation is a handful of bitwise instructions with no parsing, stack or
+// dispatch left at runtime. Used in a constant expression, a malformed literal is a compile error whose
+// diagnostic points at the message below. This header needs nothing from the library at link time.
+//
+//     STATIC_BOOLEAN_EXPRESSION(Policy, "(A & B) | !C");
+//     bool allowed = Policy::evaluate(assignment);           // Bit i of the assignment holds variable i.
+//     uint64_t rows = Policy::evaluateSliced(words);         // 64 rows at once, as for runSlicedProgram.
+//
+// Malformed literals fail with exactly the message shuntingYard or evalPostfix would give, in the same order,
+// except for juxtaposed groups such as "(T)(F)": the runtime evaluates them to the last group, while they are
+// rejected here as an operand following another operand.
+
+struct StaticNode {               // Define a structure for one node of a compile-time expression tree.
+    uint8_t opcode = OP_PUSH_FALSE;  // Member holding the operation, numbered like the bytecode.
+    uint8_t variable = 0;         // Member holding the variable a load reads.
+    uint32_t left = 0;            // Member holding the first (or only) operand.
+    uint32_t right = 0;           // Member holding the second operand.
+};
+
+template <size_t N>
+struct StaticProgram {            // Define a structure holding an expression parsed from a literal of N characters.
+    StaticNode nodes[N] = {};     // Member holding the nodes, operands before the operators using them.
+    size_t nodeCount = 0;         // Member holding the number of nodes used.
+    size_t root = 0;              // Member holding the node of the whole expression.
+    char variables[N] = {};       // Member holding the variable names, sorted, like CompiledExpression.
+    size_t variableCount = 0;     // Member holding the number of variables.
+
+    // Function to find the index of a named variable, failing to compile for an unknown name.
+    constexpr size_t variable(char name) const {
+        for (size_t i = 0; i < variableCount; ++i) {
+            if (variables[i] == name) return i;
+        }
+        throw std::invalid_argument("Unknown variable");
+    }
+};
+
+constexpr bool isStaticSpace(char c) {  // Function to check for whitespace without the locale-dependent isspace.
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+constexpr bool isStaticLetter(char c) {  // Function to check for a letter without the locale-dependent isalpha.
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+constexpr uint8_t staticOpcode(char c) {  // Function to translate an operator symbol, as operatorOpcode does.
+    switch (c) {
+        case '&': return OP_AND;
+        case '|': return OP_OR;
+        case '@': return OP_NAND;
+        case '$': return OP_XOR;
+        default:  return OP_NOT;
+    }
+}
+
+struct StaticMessage {            // Define a structure for an error message ending in the offending character.
+    char text[48] = {};           // Member holding the message, built without std::string so it works while compiling.
+
+    // Constructor that appends a character to a message prefix, as the runtime parser does.
+    template <size_t N>
+    constexpr StaticMessage(const char (&prefix)[N], char c) {
+        static_assert(N < sizeof(text), "Message too long");
+        for (size_t i = 0; i + 1 < N; ++i) text[i] = prefix[i];
+        text[N - 1] = c;
+    }
+};
+
+// Function to parse an infix literal at compile time, optionally with single-letter variables.
+template <size_t N>
+constexpr StaticProgram<N> compileStatic(const char (&expression)[N], char trueDef = 'T', char falseDef = 'F',
+                                         bool allowVariables = true) {
+    StaticProgram<N> program;
+    size_t length = 0;
+    while (length < N && expression[length] != '\0') ++length;
+    if (length == 0) throw std::runtime_error("No operands or operators present");
+
+    // Collect the variables first, sorted, so a load's index matches compilePostfix's.
+    for (size_t i = 0; i < length; ++i) {
+        char c = expression[i];
+        if (!allowVariables || !isStaticLetter(c) || c == trueDef || c == falseDef) continue;
+        size_t at = 0;
+        while (at < program.variableCount && program.variables[at] < c) ++at;
+        if (at < program.variableCount && program.variables[at] == c) continue;
+        for (size_t k = program.variableCount; k > at; --k) program.variables[k] = program.variables[k - 1];
+        program.variables[at] = c;
+        ++program.variableCount;
+    }
+
+    char operators[N] = {};       // Pending operators and open parentheses.
+    size_t operatorCount = 0;
+    uint32_t values[N + 1] = {};  // Nodes of the operands not yet consumed, with room for a pair even when N is 1.
+    size_t valueCount = 0;
+
+    // Operator of the first missing operand. evalPostfix only runs once shuntingYard has accepted the whole
+    // expression, so this is reported after every parse error, and nothing is applied after it.
+    char missingOperand = '\0';
+
+    // Lambda to turn an operator into a node over the operands it consumes.
+    auto apply = [&](char op) {
+        if (missingOperand) return;
+        StaticNode node;
+        node.opcode = staticOpcode(op);
+        if (op == '!') {
+            if (valueCount < 1) {
+                missingOperand = op;
+                return;
+            }
+            node.left = values[valueCount - 1];
+            --valueCount;
+        } else {
+            if (valueCount < 2) {
+                missingOperand = op;
+                return;
+            }
+            node.right = values[valueCount - 1];
+            node.left = values[valueCount - 2];
+            valueCount -= 2;
+        }
+        program.nodes[program.nodeCount] = node;
+        values[valueCount++] = static_cast<uint32_t>(program.nodeCount++);
+    };
+
+    bool expectOperand = true;
+    for (size_t i = 0; i < length; ++i) {
+        char c = expression[i];
+        if (isStaticSpace(c)) continue;
+        if (isStaticLetter(c) && (c == trueDef || c == falseDef || allowVariables)) {
+            if (!expectOperand) throw std::runtime_error("Operand follows another operand or does not follow an operator");
+            StaticNode node;
+            if (c == trueDef) node.opcode = OP_PUSH_TRUE;
+            else if (c == falseDef) node.opcode = OP_PUSH_FALSE;
+            else {
+                node.opcode = OP_LOAD_VAR;
+                node.variable = static_cast<uint8_t>(program.variable(c));
+            }
+            program.nodes[program.nodeCount] = node;
+            values[valueCount++] = static_cast<uint32_t>(program.nodeCount++);
+            expectOperand = false;
+        } else if (isOperator(c)) {
+            if (c != '!' && expectOperand) throw std::runtime_error(StaticMessage("Missing operand before operator: ", c).text);
+            if (c == '!' && !expectOperand) throw std::runtime_error("Consecutive operators detected without operand in between.");
+            while (operatorCount > 0 && isOperator(operators[operatorCount - 1])) {
+                char top = operators[operatorCount - 1];
+                bool displaced = isLeftAssociative(c) ? getPrecedence(c) <= getPrecedence(top)
+                                                      : getPrecedence(c) < getPrecedence(top);
+                if (!displaced) break;
+                apply(top);
+                --operatorCount;
+            }
+            operators[operatorCount++] = c;
+            expectOperand = true;
+        } else if (c == '(') {
+            if (!expectOperand) throw std::runtime_error("Operand follows another operand or does not follow an operator");
+            operators[operatorCount++] = c;
+        } else if (c == ')') {
+            while (operatorCount > 0 && operators[operatorCount - 1] != '(') apply(operators[--operatorCount]);
+            if (operatorCount == 0) throw std::runtime_error("Mismatched parentheses");
+            --operatorCount;      // Discard the '('.
+            expectOperand = false;
+        } else {
+            throw std::invalid_argument(StaticMessage("Invalid character or operator: ", c).text);
+        }
+    }
+    for (size_t k = 0; k < operatorCount; ++k) {
+        if (operators[k] == '(') throw std::runtime_error("Mismatched parentheses");
+    }
+    if (expectOperand) throw std::runtime_error("Missing operand after operator");
+    while (operatorCount > 0) apply(operators[--operatorCount]);
+    if (missingOperand == '!') throw std::runtime_error("Missing operand for NOT operation");
+    if (missingOperand) throw std::runtime_error("Missing operand for binary operator");
+    if (valueCount == 0) throw std::runtime_error("No operands or operators present");  // As for "()".
+    program.root = values[valueCount - 1];
+    return program;
+}
+
+template <typename Word>
+constexpr Word staticNot(Word a) { return static_cast<Word>(~a); }  // Function to negate every row of a word.
+template <>
+constexpr bool staticNot<bool>(bool a) { return !a; }               // Function to negate a single value.
+
+template <typename Word>
+constexpr Word staticTrue() { return staticNot(Word{}); }           // Function to give a word with every row true.
+
+// Class template that evaluates one node of a Source's program, recursing into its operands at compile
+// time so the whole tree is inlined. Source is a type with a static constexpr StaticProgram named program.
+template <typename Source, size_t Node>
+struct StaticNodeEvaluator {
+    template <typename Word, typename Load>
+    static constexpr Word evaluate(const Load& load) {
+        constexpr StaticNode node = Source::program.nodes[Node];
+        if constexpr (node.opcode == OP_PUSH_TRUE) {
+            return staticTrue<Word>();
+        } else if constexpr (node.opcode == OP_PUSH_FALSE) {
+            return Word{};
+        } else if constexpr (node.opcode == OP_LOAD_VAR) {
+            return load(node.variable);
+        } else if constexpr (node.opcode == OP_NOT) {
+            return staticNot(StaticNodeEvaluator<Source, node.left>::template evaluate<Word>(load));
+        } else {
+            Word a = StaticNodeEvaluator<Source, node.left>::template evaluate<Word>(load);
+            Word b = StaticNodeEvaluator<Source, node.right>::template evaluate<Word>(load);
+            if constexpr (node.opcode == OP_AND) return static_cast<Word>(a & b);
+            else if constexpr (node.opcode == OP_OR) return static_cast<Word>(a | b);
+            else if constexpr (node.opcode == OP_XOR) return static_cast<Word>(a ^ b);
+            else return staticNot(static_cast<Word>(a & b));  // NAND.
+        }
+    }
+};
+
+// Class template giving the evaluation entry points of a compile-time expression.
+template <typename Source>
+struct StaticExpression {
+    static constexpr size_t variableCount = Source::program.variableCount;  // Number of distinct variables.
+
+    // Function to find a variable's index, usable as a template argument or array size.
+    static constexpr size_t variable(char name) { return Source::program.variable(name); }
+
+    // Function to evaluate one assignment, where bit i of the assignment holds variable i.
+    static constexpr bool evaluate(uint64_t assignment = 0) {
+        auto load = [assignment](size_t variable) { return static_cast<bool>((assignment >> variable) & 1); };
+        return StaticNodeEvaluator<Source, Source::program.root>::template evaluate<bool>(load);
+    }
+
+    // Function to evaluate many rows at once on bit-sliced words (uint64_t or a vector type), where
+    // variables[i] holds variable i's value in each row.
+    template <typename Word>
+    static constexpr Word evaluateSliced(const Word* variables) {
+        auto load = [variables](size_t variable) { return variables[variable]; };
+        return StaticNodeEvaluator<Source, Source::program.root>::template evaluate<Word>(load);
+    }
+};
+
+// Define Name as the compile-time expression for a literal, optionally followed by the true and false
+// characters and whether variables are allowed, as for compileStatic.
+#define STATIC_BOOLEAN_EXPRESSION(Name, ...)                                       \
+    struct Name##Source {                                                          \
+        static constexpr auto program = compileStatic(__VA_ARGS__);                \
+    };                                                                             \
+    using Name = StaticExpression<Name##Source>
+
+#endif // STATICEXPRESSION_H
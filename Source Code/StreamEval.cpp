@@ -0,0 +1,80 @@
+/*
+ * StreamEval.cpp : Evaluates expressions too large to hold in memory by streaming them through the fused evaluator.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <iostream>               // Include the library for input and output streaming.
+#include <iomanip>                // Include the library for manipulating output formatting.
+#include <chrono>                 // Include the library for timing.
+#include <vector>                 // Include the library for the dynamic array container.
+#include <cerrno>                 // Include the library for system error codes.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <fcntl.h>                // Include the POSIX library for opening files.
+#include <unistd.h>               // Include the POSIX library for reading and closing files.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "StreamEval.h"           // Include the user-defined header file that declares streaming evaluation.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+const size_t STREAM_CHUNK = 1 << 20;  // Number of bytes read at a time.
+
+// Function to read and evaluate one expression chunk by chunk. Errors found while reading report the byte
+// offset of the offending character, since the text itself is no longer available.
+bool evaluateStream(const string& path, const BooleanDefinitions& definitions, StreamStats& stats) {
+    int fd = (path == "-") ? 0 : open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw runtime_error("Unable to open input file: " + path);
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);  // Hint that the file is read front to back.
+#endif
+
+    auto start = chrono::steady_clock::now();
+    vector<char> chunk(STREAM_CHUNK);  // The only buffer whose size does not depend on the expression.
+    EvalScratch scratch;               // Stacks that grow with the nesting depth alone.
+    FusedEvaluator evaluator(scratch, definitions);
+    uint64_t offset = 0;
+    bool result;
+    try {
+        while (true) {
+            ssize_t count = read(fd, chunk.data(), chunk.size());
+            if (count < 0) {
+                if (errno == EINTR) continue;
+                throw runtime_error("Unable to read input file: " + path);
+            }
+            if (count == 0) break;
+            for (ssize_t i = 0; i < count; ++i) {
+                try {
+                    evaluator.feed(chunk[i]);
+                } catch (exception& e) {
+                    throw runtime_error(string(e.what()) + " (at byte " + to_string(offset + i) + ")");
+                }
+            }
+            offset += count;
+        }
+        result = evaluator.finish();
+    } catch (...) {
+        if (fd != 0) close(fd);
+        throw;
+    }
+    if (fd != 0) close(fd);
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    stats.bytes = offset;
+    stats.seconds = elapsed.count();
+    stats.stackBytes = scratch.operators.capacity() + scratch.values.capacity();
+    return result;
+}
+
+// Function to evaluate a streamed expression and print the result with its throughput.
+int runStream(const string& path, const BooleanDefinitions& definitions) {
+    StreamStats stats;
+    bool result = evaluateStream(path, definitions, stats);
+    double megabytes = stats.bytes / 1e6;
+    cout << "Result: " << (result ? "True" : "False") << "\n"
+         << fixed << setprecision(3) << "Read " << megabytes << " MB in " << stats.seconds << " s ("
+         << setprecision(1) << (stats.seconds > 0 ? megabytes / stats.seconds : 0.0) << " MB/s), stack memory "
+         << stats.stackBytes << " bytes" << endl;
+    return 0;
+}
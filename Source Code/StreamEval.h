@@ -0,0 +1,22 @@
+#ifndef STREAMEVAL_H
+#define STREAMEVAL_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+
+struct StreamStats {              // Define a structure describing one streamed evaluation.
+    uint64_t bytes = 0;           // Member holding the number of bytes read.
+    double seconds = 0;           // Member holding the time spent reading and evaluating.
+    size_t stackBytes = 0;        // Member holding the memory the evaluation stacks grew to.
+};
+
+// Read one expression from a file ("-" for standard input) in fixed-size chunks, parsing and evaluating it
+// as it arrives. Memory is bounded by the chunk size plus the nesting depth, not the expression length.
+bool evaluateStream(const std::string& path, const BooleanDefinitions& definitions, StreamStats& stats);
+
+// Evaluate a streamed expression and print the result with its throughput. Returns the process exit code.
+int runStream(const std::string& path, const BooleanDefinitions& definitions);
+
+#endif // STREAMEVAL_H
@@ -11,13 +11,14 @@
  *   - Jack Pigott
  *
  * Creation Date: April 24, 2024
- * Modification Date: May 2, 2024
+ * Modification Date: October 17, 2026
  * 
  */
 
 #include <iostream>  // Include the library for input and output streaming.
 #include <iomanip>   // Include the library for manipulating input and output formatting.
-#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "TruthTable.h"           // Include the user-defined header file that declares the truth table functions.
+#include "TruthTableSlices.h"     // Include the user-defined header file that declares the row slices.
 
 // Define a function implementing the AND logic gate.
 bool AND(bool a, bool b) {
@@ -45,9 +46,9 @@ bool NOT(bool a) {
 }
 
 // Function to print the truth table for two variables.
-void printTruthTable() {
+void printTruthTable(const BooleanDefinitions& definitions) {
     // Print headers for the truth table columns.
-    std::cout << trueDef << " " << falseDef << "|\tAND\tOR\tNAND\tXOR |\tNOT " << trueDef << "\t\tNOT " << falseDef << "\n";
+    std::cout << definitions.trueDef << " " << definitions.falseDef << "|\tAND\tOR\tNAND\tXOR |\tNOT " << definitions.trueDef << "\t\tNOT " << definitions.falseDef << "\n";
     // Print a line to separate headers from the data.
     std::cout << "--------------------------------------------------------------"<< std::endl;
     // Nested loops to generate all combinations of A and B.
@@ -60,3 +61,64 @@ void printTruthTable() {
         }
     }
 }
+
+// Function to fill in every variable's column for the slice that starts at the given row.
+// The first variable is the most significant bit of the row number, as in a written truth table.
+void loadVariableSlices(size_t variableCount, uint64_t firstRow, RowSlice* variables) {
+    static const uint64_t patterns[6] = {   // Columns of the six low row bits within one word.
+        0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+        0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+    };
+    for (size_t i = 0; i < variableCount; ++i) {
+        size_t bit = variableCount - 1 - i; // Row bit that holds this variable.
+        for (int w = 0; w < SLICE_WORDS; ++w) {
+            uint64_t wordRow = firstRow + 64 * static_cast<uint64_t>(w);  // Row held in bit 0 of the word.
+            variables[i][w] = (bit < 6) ? patterns[bit] : (((wordRow >> bit) & 1) ? ~0ULL : 0ULL);
+        }
+    }
+}
+
+// Function to mask off the rows of a slice word that lie past the end of the table.
+uint64_t validRowMask(uint64_t wordRow, uint64_t rowCount) {
+    if (wordRow >= rowCount) return 0;                 // The whole word is past the end.
+    uint64_t remaining = rowCount - wordRow;           // Rows of the table left from this word on.
+    return (remaining >= 64) ? ~0ULL : ((1ULL << remaining) - 1);
+}
+
+// Function to count the true rows in one slice.
+uint64_t countRowSlice(const RowSlice& results, uint64_t firstRow, uint64_t rowCount) {
+    uint64_t count = 0;
+    for (int w = 0; w < SLICE_WORDS; ++w) {
+        count += __builtin_popcountll(results[w] & validRowMask(firstRow + 64 * static_cast<uint64_t>(w), rowCount));
+    }
+    return count;
+}
+
+// Function to append the text of one row to a buffer, with the variables as the bits of the row number.
+void formatRow(uint64_t row, size_t variableCount, bool result, std::string& out) {
+    for (size_t i = 0; i < variableCount; ++i) {      // Print each variable's value for the row.
+        out += static_cast<char>('0' + ((row >> (variableCount - 1 - i)) & 1));
+        out += ' ';
+    }
+    out += "| ";
+    out += result ? '1' : '0';
+    out += '\n';
+}
+
+// Function to append the rows of one slice to a text buffer, optionally only the rows that are true.
+void formatRowSlice(const RowSlice& results, uint64_t firstRow, uint64_t rowCount, size_t variableCount,
+                    bool satisfyingOnly, std::string& out) {
+    for (int w = 0; w < SLICE_WORDS; ++w) {
+        uint64_t wordRow = firstRow + 64 * static_cast<uint64_t>(w);  // Row held in bit 0 of the word.
+        uint64_t valid = validRowMask(wordRow, rowCount);
+        if (satisfyingOnly) {
+            for (uint64_t bits = results[w] & valid; bits != 0; bits &= bits - 1) {  // Visit each set bit.
+                formatRow(wordRow + __builtin_ctzll(bits), variableCount, true, out);
+            }
+        } else {
+            for (int k = 0; k < 64 && ((valid >> k) & 1); ++k) {
+                formatRow(wordRow + k, variableCount, (results[w] >> k) & 1, out);
+            }
+        }
+    }
+}
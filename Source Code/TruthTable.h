@@ -0,0 +1,51 @@
+#ifndef TRUTHTABLE_H
+#define TRUTHTABLE_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "Bytecode.h"             // Include the user-defined header file that declares the bytecode format.
+
+bool AND(bool a, bool b);         // AND logic gate.
+bool OR(bool a, bool b);          // OR logic gate.
+bool NAND(bool a, bool b);        // NAND logic gate.
+bool XOR(bool a, bool b);         // XOR logic gate.
+bool NOT(bool a);                 // NOT logic gate.
+
+void printTruthTable(const BooleanDefinitions& definitions);  // Print the truth table for two variables.
+
+// Define the logic gates on whole words, where bit k of each operand belongs to row k.
+template <typename Word> Word sliceAND(Word a, Word b) { return a & b; }     // AND of every row at once.
+template <typename Word> Word sliceOR(Word a, Word b) { return a | b; }      // OR of every row at once.
+template <typename Word> Word sliceNAND(Word a, Word b) { return ~(a & b); } // NAND of every row at once.
+template <typename Word> Word sliceXOR(Word a, Word b) { return a ^ b; }     // XOR of every row at once.
+template <typename Word> Word sliceNOT(Word a) { return ~a; }                // NOT of every row at once.
+
+// Function to run bytecode on bit-sliced values, so each instruction evaluates a whole slice of rows. Any word
+// type works; uint64_t covers 64 rows, and the library's truth tables use the vector type in TruthTableSlices.h.
+template <typename Slice>
+Slice runSlicedProgram(const uint8_t* code, size_t length, Slice* stack, const Slice* variables) {
+    size_t top = 0;               // Number of slices currently on the stack.
+    for (size_t i = 0; i < length; ++i) {
+        switch (code[i]) {
+            case OP_PUSH_TRUE:  stack[top++] = sliceNOT(Slice{}); break;  // Every row is true.
+            case OP_PUSH_FALSE: stack[top++] = Slice{}; break;            // Every row is false.
+            case OP_AND:  --top; stack[top - 1] = sliceAND(stack[top - 1], stack[top]); break;
+            case OP_OR:   --top; stack[top - 1] = sliceOR(stack[top - 1], stack[top]); break;
+            case OP_NAND: --top; stack[top - 1] = sliceNAND(stack[top - 1], stack[top]); break;
+            case OP_XOR:  --top; stack[top - 1] = sliceXOR(stack[top - 1], stack[top]); break;
+            case OP_NOT:  stack[top - 1] = sliceNOT(stack[top - 1]); break;
+            case OP_LOAD_VAR: stack[top++] = variables[code[++i]]; break; // Push a variable's column.
+        }
+    }
+    return stack[top - 1];        // Return the result column.
+}
+
+// Mask off the rows of a slice word that lie past the end of the table.
+uint64_t validRowMask(uint64_t wordRow, uint64_t rowCount);
+
+// Append the text of one row to a buffer.
+void formatRow(uint64_t row, size_t variableCount, bool result, std::string& out);
+
+#endif // TRUTHTABLE_H
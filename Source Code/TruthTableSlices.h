@@ -0,0 +1,36 @@
+#ifndef TRUTHTABLESLICES_H
+#define TRUTHTABLESLICES_H
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstddef>                // Include the library for size types.
+#include <string>                 // Include the library for string manipulation.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+
+// Internal to the library: the vector type the truth tables and the netlist simulator evaluate with. Its width
+// depends on the instruction set the library is compiled for, so it is kept out of the public headers, where
+// callers built with other flags would see a different type and calling convention.
+
+// Choose the widest row slice the target supports; each 64-bit word of a slice holds 64 truth table rows.
+#if defined(__AVX512F__)
+const int SLICE_WORDS = 8;  // One AVX-512 register covers 512 rows.
+#elif defined(__AVX2__)
+const int SLICE_WORDS = 4;  // One AVX2 register covers 256 rows.
+#elif defined(__SSE2__)
+const int SLICE_WORDS = 2;  // One SSE2 register covers 128 rows.
+#else
+const int SLICE_WORDS = 1;  // A plain 64-bit word covers 64 rows.
+#endif
+typedef uint64_t RowSlice __attribute__((vector_size(8 * SLICE_WORDS)));  // Vector of words evaluated together.
+const uint64_t SLICE_ROWS = 64 * SLICE_WORDS;                             // Number of rows covered by one slice.
+
+// Fill in every variable's column for the slice that starts at the given row.
+void loadVariableSlices(size_t variableCount, uint64_t firstRow, RowSlice* variables);
+
+// Count the true rows in one slice.
+uint64_t countRowSlice(const RowSlice& results, uint64_t firstRow, uint64_t rowCount);
+
+// Append the rows of one slice to a text buffer, optionally only the rows that are true.
+void formatRowSlice(const RowSlice& results, uint64_t firstRow, uint64_t rowCount, size_t variableCount,
+                    bool satisfyingOnly, std::string& out);
+
+#endif // TRUTHTABLESLICES_H
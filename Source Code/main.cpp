@@ -11,59 +11,167 @@
  *   - Jack Pigott
  *
  * Creation Date: April 24, 2024
- * Modification Date: May 2, 2024
+ * Modification Date: October 17, 2026
  * 
  */
 
 #include <iostream>               // Include the library for input and output streaming.
 #include <stdexcept>              // Include the library for standard exceptions.
-#include <stack>                  // Include the library for using stack data structures.
 #include <string>                 // Include the library for string manipulation.
 #include <limits>                 // Include the library for error handling
-#include "FileParse.cpp"          // Include custom functions from FileParse.cpp for parsing.
-#include "TruthTable.cpp"         // Include custom functions from TruthTable.cpp for truth table printing.
-#include "BooleanDefinitions.cpp"   // Include custom functions from BooleanDefinitions.cpp for defining booleans.
+#include <fstream>                // Include the library for writing output files.
 #include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "EvalContext.h"          // Include the user-defined header file that declares the evaluation context.
+#include "TruthTable.h"           // Include the user-defined header file that declares the truth table functions.
+#include "ParallelTruthTable.h"   // Include the user-defined header file that declares the parallel truth table.
+#include "BDD.h"                  // Include the user-defined header file that declares expression analysis.
+#include "BatchMode.h"            // Include the user-defined header file that declares batch mode.
+#include "StreamEval.h"           // Include the user-defined header file that declares streaming evaluation.
+#include "IncrementalEval.h"      // Include the user-defined header file that declares incremental evaluation.
+#include "Netlist.h"              // Include the user-defined header file that declares the netlist simulator.
+#include "CompiledLibrary.h"      // Include the user-defined header file that declares precompiled libraries.
+#include "Benchmark.h"            // Include the user-defined header file that declares the benchmarks.
 
 using namespace std;              // Use the standard namespace to avoid prefixing with std::.
 
-// Function to evaluate a postfix expression consisting of boolean values.
-bool evalPostfix(const string& postfix) {
-    stack<bool> evalStack;        // Stack to hold boolean values during evaluation.
+// Function to print the command line usage for the non-interactive modes.
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [--batch <input|-> [--out <output|->] [--threads <count>] [--true <char>] [--false <char>]]\n"
+         << "       " << program << " --table <expression> [--rows all|satisfying|count] [--out <output|->] [--threads <count>]\n"
+         << "       " << program << " --stream <expression file|->\n"
+         << "       " << program << " --incremental <expression> [--deltas <changes|->] [--out <output|->]\n"
+         << "       " << program << " --netlist <circuit> [--stimulus <vectors|->] [--out <output|->] [--threads <count>]\n"
+         << "       " << program << " --export <expression file|-> [--out <library|->]\n"
+         << "       " << program << " --library <library|-> [--stimulus <assignments|->] [--out <output|->]\n"
+         << "       " << program << " --bench\n"
+         << "Run without arguments to start the interactive calculator." << endl;
+}
 
-    // Iterate over each character in the postfix expression.
-    for (char c : postfix) {
-        // Check if character is a boolean literal 'T' or 'F'.
-        if (c == trueDef || c == falseDef) {
-            evalStack.push(c == trueDef);  // Push true for 'T', false for 'F'.
-        } else if (isOperator(c)) {   // Check if character is an operator.
-            if (c == '!') {           // Specifically check for the NOT operator.
-                if (evalStack.empty()) throw runtime_error("Missing operand for NOT operation");
-                bool val = evalStack.top(); // Retrieve the top value from stack.
-                evalStack.pop();            // Remove the top value.
-                evalStack.push(!val);       // Push the negated value back onto the stack.
-            } else { // Handling for binary operators (AND, OR, NAND, XOR).
-                if (evalStack.size() < 2) throw runtime_error("Missing operand for binary operator");
-                bool val1 = evalStack.top(); // Right operand.
-                evalStack.pop();             // Remove the right operand.
-                bool val2 = evalStack.top(); // Left operand.
-                evalStack.pop();             // Remove the left operand.
-                // Perform operation based on the operator and push the result.
-                switch (c) {
-                    case '&': evalStack.push(val2 && val1); break;  // AND operation.
-                    case '|': evalStack.push(val2 || val1); break;  // OR operation.
-                    case '@': evalStack.push(!(val2 && val1)); break; // NAND operation.
-                    case '$': evalStack.push(val2 != val1); break;   // XOR operation.
-                }
+// Function to handle the command line options, returning the process exit code.
+int runCommandLine(int argc, char* argv[]) {
+    string inputPath;              // Path of the batch input file, or "-" for standard input.
+    string tableExpression;        // Expression whose truth table is printed.
+    string streamPath;             // Path of a single expression too large to read whole, or "-" for standard input.
+    string incrementalExpression;  // Expression re-evaluated as its inputs change.
+    string deltaPath;              // Path of the input changes, or "-" for standard input.
+    string netlistPath;            // Path of the circuit to simulate.
+    string stimulusPath;           // Path of the stimulus vectors, or "-" for standard input.
+    string exportPath;             // Path of the expressions compiled into a library, or "-" for standard input.
+    string libraryPath;            // Path of a precompiled library to load.
+    TableMode tableMode = TABLE_ALL_ROWS;  // Which rows of the truth table are printed.
+    string outputPath = "-";       // Path of the batch output file, or "-" for standard output.
+    unsigned threadCount = 0;      // Number of worker threads, or 0 to use every core.
+    BooleanDefinitions definitions;  // Characters standing for true and false.
+
+    if (argc == 2 && string(argv[1]) == "--bench") {  // Run the bytecode benchmark on its own.
+        runBytecodeBenchmark(definitions);
+        runDagBenchmark(definitions);
+        return 0;
+    }
+
+    // Iterate over each option and its value.
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (i + 1 >= argc) {       // Every option takes exactly one value.
+            printUsage(argv[0]);
+            return 1;
+        }
+        string value = argv[++i];
+        if (option == "--batch") {
+            inputPath = value;
+        } else if (option == "--table") {
+            tableExpression = value;
+        } else if (option == "--stream") {
+            streamPath = value;
+        } else if (option == "--incremental") {
+            incrementalExpression = value;
+        } else if (option == "--deltas") {
+            deltaPath = value;
+        } else if (option == "--netlist") {
+            netlistPath = value;
+        } else if (option == "--stimulus") {
+            stimulusPath = value;
+        } else if (option == "--export") {
+            exportPath = value;
+        } else if (option == "--library") {
+            libraryPath = value;
+        } else if (option == "--rows" && (value == "all" || value == "satisfying" || value == "count")) {
+            tableMode = (value == "all") ? TABLE_ALL_ROWS : (value == "satisfying") ? TABLE_SATISFYING_ROWS : TABLE_COUNT_ONLY;
+        } else if (option == "--out") {
+            outputPath = value;
+        } else if (option == "--threads") {
+            try {
+                threadCount = static_cast<unsigned>(stoul(value));
+            } catch (exception&) { // Reject thread counts that are not numbers.
+                printUsage(argv[0]);
+                return 1;
             }
+        } else if ((option == "--true" || option == "--false") && value.size() == 1) {
+            (option == "--true" ? definitions.trueDef : definitions.falseDef) = value[0];  // Assign the requested definition.
+        } else {
+            printUsage(argv[0]);
+            return 1;
         }
     }
-    return evalStack.top();        // Return the result of the evaluated expression.
+
+    int modes = !inputPath.empty() + !tableExpression.empty() + !streamPath.empty() + !incrementalExpression.empty() +
+                !netlistPath.empty() + !exportPath.empty() + !libraryPath.empty();
+    if (modes != 1 || (!stimulusPath.empty() && netlistPath.empty() && libraryPath.empty()) || (!deltaPath.empty() && incrementalExpression.empty()) ||
+        definitions.trueDef == definitions.falseDef) {  // Exactly one mode with distinct definitions.
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    try {
+        if (!streamPath.empty()) {       // Evaluate one huge expression without holding it in memory.
+            return runStream(streamPath, definitions);
+        }
+        if (!incrementalExpression.empty()) {  // Follow the input changes, or sweep in Gray-code order.
+            return runIncremental(incrementalExpression, deltaPath, outputPath, definitions);
+        }
+        if (!exportPath.empty()) {       // Compile every expression once and save the bytecode.
+            return runExport(exportPath, outputPath, definitions);
+        }
+        if (!libraryPath.empty()) {      // Map precompiled expressions and evaluate them without parsing.
+            return runLibrary(libraryPath, stimulusPath, outputPath, definitions);
+        }
+        if (!netlistPath.empty()) {      // Load the circuit, then simulate the stimulus if one is given.
+            ifstream file(netlistPath);
+            if (!file) throw runtime_error("Unable to open netlist file: " + netlistPath);
+            Netlist netlist(file);
+            if (stimulusPath.empty()) {
+                cout << "Inputs: " << netlist.inputCount() << ", outputs: " << netlist.outputCount()
+                     << ", gates: " << netlist.gateCount() << ", levels: " << netlist.levelCount() << endl;
+                return 0;
+            }
+            runStimulus(netlist, stimulusPath, outputPath, threadCount);
+            return 0;
+        }
+        if (!tableExpression.empty()) {  // Stream the truth table to the output.
+            if (outputPath == "-") {
+                printExpressionTruthTable(tableExpression, definitions, tableMode, cout, threadCount);
+                return 0;
+            }
+            ofstream file(outputPath, ios::binary);
+            if (!file) throw runtime_error("Unable to open output file: " + outputPath);
+            printExpressionTruthTable(tableExpression, definitions, tableMode, file, threadCount);
+            if (!file) throw runtime_error("Unable to write output file: " + outputPath);
+            return 0;
+        }
+        return runBatch(inputPath, outputPath, threadCount, definitions);  // Evaluate the whole file.
+    } catch (exception& e) {       // Catch and report any file errors.
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
 }
 
 // Main function of the program, handling user interactions.
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1) return runCommandLine(argc, argv);  // Run non-interactively when options are given.
+
     bool running = true;           // Control variable to keep the program running.
+    EvalContext context;           // Definitions and parse cache shared by every calculator session.
+    BooleanDefinitions& definitions = context.definitions();  // Characters standing for true and false.
 
     // Main loop to present options and handle user input continuously.
     while (running) {
@@ -73,6 +181,7 @@ int main() {
              << "2) Define True and False\n"
              << "3) Truth Table\n"
              << "4) Exit\n"
+             << "5) Expression Analysis\n"
              << endl;
 
         int choice;                // Variable to store user's choice.
@@ -95,14 +204,18 @@ int main() {
                 bool continueCalculator = true;  // Control variable for calculator loop.
                 while (continueCalculator) {
                     string expression;  // String to store the user's boolean expression.
-                    cout << "\nEnter a boolean expression using '" << trueDef << "' for true and '" << falseDef << "' for false (or type 'exit' to return to main menu): ";
+                    cout << "\nEnter a boolean expression using '" << definitions.trueDef << "' for true and '" << definitions.falseDef << "' for false (or type 'exit' to return to main menu, 'stats' for cache statistics): ";
                     getline(cin, expression); // Read the complete line as an expression.
                     if (expression == "exit") {
                         continueCalculator = false;  // Exit calculator loop if user types 'exit'.
+                    } else if (expression == "stats") {
+                        ParseCacheStats stats = context.cacheStats();  // Report how well the cache is working.
+                        cout << "Cache hits: " << stats.hits << ", misses: " << stats.misses
+                             << ", evictions: " << stats.evictions << ", invalidations: " << stats.invalidations
+                             << ", size: " << stats.size << "/" << stats.capacity << endl;
                     } else {
                         try {
-                            string postfix = shuntingYard(expression); // Convert expression to postfix notation.
-                            bool result = evalPostfix(postfix);        // Evaluate the postfix expression.
+                            bool result = context.calculate(expression);  // Parse, reusing earlier parses, and evaluate.
                             cout << "Result: " << (result ? "True" : "False") << endl;
                         } catch (exception& e) { // Catch and report any exceptions.
                             cout << "Error: " << e.what() << endl;
@@ -112,15 +225,46 @@ int main() {
                 break;
             }
             case 2:                // Case for defining true and false.
-                defineTrueFalse();
+                defineTrueFalse(definitions);
                 break;
-            case 3:                // Case for printing Truth Table.
+            case 3: {              // Case for printing Truth Table.
+                string expression; // String to store the expression whose table is printed.
+                cout << "\nEnter a boolean expression using letters as variables (or press Enter for the logic gate table): ";
+                getline(cin, expression);
+                TableMode mode = TABLE_ALL_ROWS;  // Which rows of the truth table are printed.
+                if (!expression.empty()) {
+                    string modeChoice;  // String to store the user's choice of rows.
+                    cout << "Show 1) all rows, 2) satisfying rows only or 3) the count only [1]: ";
+                    getline(cin, modeChoice);
+                    if (modeChoice == "2") mode = TABLE_SATISFYING_ROWS;
+                    else if (modeChoice == "3") mode = TABLE_COUNT_ONLY;
+                }
                 cout << "\n" << endl;
-                printTruthTable();
+                try {
+                    if (expression.empty()) printTruthTable(definitions);     // Print the gate table for two variables.
+                    else printExpressionTruthTable(expression, definitions, mode);  // Print the table of the expression.
+                } catch (exception& e) { // Catch and report any exceptions.
+                    cout << "Error: " << e.what() << endl;
+                }
                 break;
+            }
             case 4:                // Case to exit the program.
                 running = false;   // Set running to false, stopping the loop.
                 break;
+            case 5: {              // Case for analyzing expressions with binary decision diagrams.
+                string first, second;  // Strings to store the expressions being analyzed.
+                cout << "\nEnter a boolean expression using letters as variables: ";
+                getline(cin, first);
+                cout << "Enter a second expression to check equivalence (or press Enter to skip): ";
+                getline(cin, second);
+                cout << endl;
+                try {
+                    printBddAnalysis(first, second, definitions);
+                } catch (exception& e) { // Catch and report any exceptions.
+                    cout << "Error: " << e.what() << endl;
+                }
+                break;
+            }
             default:               // Default case for invalid input.
                 cout << "Invalid Input. Please Try Again." << endl;
                 break;
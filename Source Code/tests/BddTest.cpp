@@ -0,0 +1,104 @@
+/*
+ * BddTest.cpp : Checks BDD model counts and witnesses against brute-force evaluation with evalPostfix.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "BDD.h"                  // Include the user-defined header file that declares the BDD manager.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to build an expression's BDD and check its model count, a witness, its negation and a few
+// rewrites that must give the very same node, returning the BDD protected so it survives later collections.
+static BddRef checkExpression(BddManager& manager, const string& expression, const BooleanDefinitions& definitions) {
+    string variables;
+    vector<bool> rows = referenceTruthTable(expression, definitions, variables);
+    uint64_t expected = 0;
+    for (bool row : rows) expected += row;
+
+    CompiledExpression program = compileExpression(expression, definitions, true);
+    CHECK_EQUAL(program.variables, variables, expression);
+    vector<uint32_t> levels(program.variables.size());
+    for (size_t i = 0; i < levels.size(); ++i) levels[i] = static_cast<uint32_t>(i);
+    uint32_t variableCount = static_cast<uint32_t>(levels.size());
+
+    BddRef root = manager.build(program, levels);
+    manager.protect(root);
+    CHECK_EQUAL(manager.satCount(root, variableCount), expected, expression);
+
+    vector<bool> witness;
+    bool found = manager.anySat(root, variableCount, witness);
+    CHECK_EQUAL(found, expected > 0, expression);
+    if (found) {
+        uint64_t row = 0;
+        for (size_t v = 0; v < witness.size(); ++v) row |= static_cast<uint64_t>(witness[v]) << v;
+        CHECK_EQUAL(rows[row], true, expression << ", witness " << formatAssignment(variables, witness));
+    }
+
+    // Canonical form: equivalent expressions share a node, and complements count the other rows.
+    const string wrapped = "(" + expression + ")";
+    CHECK_EQUAL(manager.build(compileExpression("!!" + wrapped, definitions, true), levels), root, expression);
+    CHECK_EQUAL(manager.build(compileExpression(wrapped + " & " + wrapped, definitions, true), levels), root, expression);
+    CHECK_EQUAL(manager.build(compileExpression(wrapped + " $ " + wrapped, definitions, true), levels), BDD_FALSE, expression);
+    BddRef negated = manager.build(compileExpression(wrapped + " @ " + wrapped, definitions, true), levels);
+    CHECK_EQUAL(negated, manager.negate(root), expression);
+    CHECK_EQUAL(manager.satCount(negated, variableCount), rows.size() - expected, expression);
+    return root;
+}
+
+int main() {
+    BooleanDefinitions definitions;
+    mt19937_64 rng(1618);
+
+    // Constants, tautologies and contradictions collapse to the terminals.
+    {
+        BddManager manager;
+        for (const char* expression : {"T", "F", "!T", "A & !A", "A | !A", "A $ A", "(A @ B) | (A & B)"}) {
+            checkExpression(manager, expression, definitions);
+        }
+        CHECK_EQUAL(manager.build(compileExpression("A | !A", definitions, true), {0}), BDD_TRUE, "A | !A");
+        CHECK_EQUAL(manager.build(compileExpression("A & !A", definitions, true), {0}), BDD_FALSE, "A & !A");
+    }
+
+    // Random expressions over up to ten variables. A tiny apply cache forces collisions, and a collection
+    // threshold of a few nodes collects garbage after nearly every operation while a BDD is being built.
+    for (double threshold : {1e9, 64.0, 4.0}) {
+        BddManager manager(64);
+        manager.setCollectThreshold(static_cast<size_t>(threshold));
+        GeneratorOptions options;
+        options.operands = 24;
+        options.maxDepth = 6;
+        options.notChance = 0.25;
+        options.variables = "ABCDEGHIJK";
+        options.variableChance = 0.85;
+        ExpressionGenerator generator(options, definitions, rng());
+        vector<pair<string, BddRef>> kept;  // BDDs kept alive across later builds and collections.
+        for (int i = 0; i < 150; ++i) {
+            string expression = generator.next();
+            kept.emplace_back(expression, checkExpression(manager, expression, definitions));
+            if (i % 10 == 9) {    // Release half of the kept BDDs and collect; the rest must be unchanged.
+                for (size_t k = 0; k < kept.size(); k += 2) manager.release(kept[k].second);
+                manager.collectGarbage();
+                vector<pair<string, BddRef>> survivors;
+                for (size_t k = 1; k < kept.size(); k += 2) survivors.push_back(kept[k]);
+                kept.swap(survivors);
+                for (const auto& entry : kept) {
+                    BddRef rebuilt = manager.build(compileExpression(entry.first, definitions, true),
+                                                   vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+                    CHECK_EQUAL(rebuilt, entry.second, entry.first << ", after collection");
+                }
+            }
+        }
+    }
+
+    return testResult("BddTest");
+}
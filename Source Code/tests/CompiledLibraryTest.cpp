@@ -0,0 +1,176 @@
+/*
+ * CompiledLibraryTest.cpp : Checks that libraries round-trip and that every kind of damage is rejected.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstddef>                // Include the library for offsetof.
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstdio>                 // Include the library for removing files.
+#include <cstring>                // Include the library for copying memory.
+#include <fstream>                // Include the library for writing library files.
+#include <sstream>                // Include the library for writing a library to memory.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "CompiledLibrary.h"      // Include the user-defined header file that declares the library format.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+static const char* const libraryPath = "CompiledLibraryTest.lib";  // Scratch file, in the test's directory.
+
+// Function to write bytes to the scratch file and load them, returning the error, or "" if they loaded.
+static string loadError(const string& bytes, const BooleanDefinitions& definitions) {
+    {
+        ofstream file(libraryPath, ios::binary | ios::trunc);
+        file.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+    }
+    try {
+        CompiledLibrary library(libraryPath, definitions);
+        return "";
+    } catch (exception& e) {
+        return e.what();
+    }
+}
+
+// Function to check that damaged bytes are rejected with a message containing the expected text.
+static void checkRejected(const string& bytes, const BooleanDefinitions& definitions, const string& expected,
+                          const string& note) {
+    string error = loadError(bytes, definitions);
+    CHECK_EQUAL(error.find(expected) != string::npos, true, note << ": got \"" << error << "\"");
+}
+
+// Function to read a header field of a library held in memory.
+template <typename Field>
+static Field readField(const string& bytes, size_t offset) {
+    Field value;
+    memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+// Function to overwrite a field of a library held in memory.
+template <typename Field>
+static void writeField(string& bytes, size_t offset, Field value) {
+    memcpy(&bytes[offset], &value, sizeof(value));
+}
+
+// Function to store a fresh checksum, so a damaged table is caught by the table checks rather than the checksum.
+static void resign(string& bytes) {
+    const uint8_t* body = reinterpret_cast<const uint8_t*>(bytes.data()) + sizeof(LibraryHeader);
+    writeField(bytes, offsetof(LibraryHeader, checksum), libraryChecksum(body, bytes.size() - sizeof(LibraryHeader)));
+}
+
+int main() {
+    BooleanDefinitions definitions;
+
+    // Literal and variable expressions of several sizes, ending with one whose bytecode leaves some padding.
+    vector<string> expressions = {"T", "F", "!T & F", "A", "!A", "A & B | !C", "(A @ B) $ (C | D) & !(E @ F)",
+                                  "T $ A $ F $ B"};
+    GeneratorOptions options;
+    options.operands = 24;
+    options.variables = "ABCDEGH";
+    options.variableChance = 0.6;
+    ExpressionGenerator generator(options, definitions, 4242);
+    for (int i = 0; i < 40; ++i) expressions.push_back(generator.next());
+    vector<CompiledExpression> programs;
+    size_t codeBytes = 0;
+    for (const string& expression : expressions) {
+        programs.push_back(compileExpression(expression, definitions, true));
+        codeBytes += programs.back().code.size();
+    }
+    while (codeBytes % 8 == 0 || codeBytes % 8 == 7) {  // Leave at least two padding bytes.
+        expressions.push_back("T");
+        programs.push_back(compileExpression("T", definitions, true));
+        ++codeBytes;
+    }
+
+    stringstream written;
+    writeCompiledLibrary(programs, definitions, written);
+    const string bytes = written.str();
+    CHECK_EQUAL(bytes.size() % 8, 0u, "library size");
+
+    // Round trip: every entry computes the reference truth table and keeps its variable names.
+    CHECK_EQUAL(loadError(bytes, definitions), string(), "intact library");
+    {
+        CompiledLibrary library(libraryPath, definitions);
+        CHECK_EQUAL(library.size(), expressions.size(), "expression count");
+        vector<uint8_t> stack(library.maxDepth());
+        for (size_t i = 0; i < library.size() && i < expressions.size(); ++i) {
+            string variables;
+            vector<bool> rows = referenceTruthTable(expressions[i], definitions, variables);
+            LibraryExpression view = library.expression(i);
+            CHECK_EQUAL(string(view.variables, view.variableCount), variables, expressions[i]);
+            CHECK_EQUAL(view.length, programs[i].code.size(), expressions[i]);
+            for (uint64_t row = 0; row < rows.size(); ++row) {
+                CHECK_EQUAL(library.evaluate(i, stack.data(), row), rows[row], expressions[i] << ", row " << row);
+            }
+        }
+    }
+
+    // An empty library is valid and holds nothing.
+    {
+        stringstream empty;
+        writeCompiledLibrary({}, definitions, empty);
+        CHECK_EQUAL(loadError(empty.str(), definitions), string(), "empty library");
+    }
+
+    // A library only loads with the characters it was built with.
+    BooleanDefinitions swapped;
+    swapped.trueDef = definitions.falseDef;
+    swapped.falseDef = definitions.trueDef;
+    checkRejected(bytes, swapped, "Library was built with", "swapped true and false");
+    BooleanDefinitions other;
+    other.trueDef = 'Y';
+    other.falseDef = 'N';
+    checkRejected(bytes, other, "Library was built with", "other true and false");
+
+    // A flipped byte of the checksum, or of anything it covers, is caught by the checksum.
+    string damaged = bytes;
+    damaged[offsetof(LibraryHeader, checksum) + 3] ^= 0x10;
+    checkRejected(damaged, definitions, "checksum mismatch", "flipped checksum byte");
+    damaged = bytes;
+    damaged[bytes.size() - 9] ^= 0x01;
+    checkRejected(damaged, definitions, "checksum mismatch", "flipped table byte");
+
+    // Truncated files: a missing last word, and less than a header.
+    checkRejected(bytes.substr(0, bytes.size() - 8), definitions, "truncated", "missing last word");
+    checkRejected(bytes.substr(0, sizeof(LibraryHeader) - 1), definitions, "Not a compiled expression library",
+                  "partial header");
+
+    // Reserved bytes must stay zero, each of them.
+    for (size_t i = 0; i < sizeof(LibraryHeader::reserved); ++i) {
+        damaged = bytes;
+        damaged[offsetof(LibraryHeader, reserved) + i] = 1;
+        checkRejected(damaged, definitions, "tables are corrupt", "reserved byte " + to_string(i));
+    }
+
+    // Padding after the bytecode must stay zero, even under a valid checksum.
+    uint64_t codeOffset = readField<uint64_t>(bytes, offsetof(LibraryHeader, codeOffset));
+    CHECK(codeOffset + codeBytes < bytes.size());
+    damaged = bytes;
+    damaged[bytes.size() - 1] = 1;
+    resign(damaged);
+    checkRejected(damaged, definitions, "padding is not zero", "nonzero padding");
+
+    // An entry whose bytecode runs past the code table is rejected by index, even under a valid checksum.
+    size_t lastEntry = sizeof(LibraryHeader) + (programs.size() - 1) * sizeof(LibraryEntry);
+    damaged = bytes;
+    uint32_t length = readField<uint32_t>(damaged, lastEntry + offsetof(LibraryEntry, codeLength));
+    writeField<uint32_t>(damaged, lastEntry + offsetof(LibraryEntry, codeLength), length + 8);
+    resign(damaged);
+    checkRejected(damaged, definitions, "Library expression " + to_string(programs.size() - 1) + " is corrupt",
+                  "code length past the table");
+    damaged = bytes;
+    writeField<uint64_t>(damaged, lastEntry + offsetof(LibraryEntry, codeStart), codeBytes);
+    resign(damaged);
+    checkRejected(damaged, definitions, "Library expression " + to_string(programs.size() - 1) + " is corrupt",
+                  "code start past the table");
+
+    remove(libraryPath);
+    return testResult("CompiledLibraryTest");
+}
@@ -0,0 +1,85 @@
+/*
+ * ExpressionDagTest.cpp : Checks the simplified expression graph against evalPostfix on every assignment.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "ExpressionDag.h"        // Include the user-defined header file that declares the expression graph.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to check an expression's graph against the reference on every assignment, evaluating the rows in
+// order and then again in reverse so stale values from an earlier evaluation would show. Returns the graph size.
+static size_t checkExpression(const string& expression, const BooleanDefinitions& definitions) {
+    string variables;
+    vector<bool> rows = referenceTruthTable(expression, definitions, variables);
+    ExpressionDag dag(compileExpression(expression, definitions, true));
+    CHECK_EQUAL(dag.variables(), variables, expression);
+    for (uint64_t row = 0; row < rows.size(); ++row) {
+        if (dag.evaluate(row) != rows[row]) {
+            CHECK_EQUAL(dag.evaluate(row), rows[row], expression << ", row " << row);
+            return dag.dagNodes();  // One report per expression is enough.
+        }
+    }
+    for (uint64_t row = rows.size(); row-- > 0;) CHECK_EQUAL(dag.evaluate(row), rows[row], expression << ", row " << row);
+    CHECK(dag.dagNodes() <= dag.sourceNodes());
+    return dag.dagNodes();
+}
+
+int main() {
+    BooleanDefinitions definitions;
+    mt19937_64 rng(4669);
+
+    // Random expressions over few variables with heavy negation, so repeated and negated subexpressions,
+    // constants next to variables and every operator mix come up often.
+    for (const char* letters : {"AB", "ABC", "ABCDEGHIJK"}) {
+        GeneratorOptions options;
+        options.operands = 20;
+        options.maxDepth = 6;
+        options.notChance = 0.35;
+        options.variables = letters;
+        options.variableChance = 0.8;
+        ExpressionGenerator generator(options, definitions, rng());
+        for (int i = 0; i < 300; ++i) checkExpression(generator.next(), definitions);
+    }
+
+    // Every identity the builder rewrites, applied to random subexpressions, with the size it must reduce to.
+    GeneratorOptions options;
+    options.operands = 6;
+    options.maxDepth = 3;
+    options.notChance = 0.3;
+    options.variables = "ABCD";
+    options.variableChance = 0.9;
+    ExpressionGenerator generator(options, definitions, rng());
+    for (int i = 0; i < 100; ++i) {
+        const string x = "(" + generator.next() + ")";
+        const string y = "(" + generator.next() + ")";
+        size_t size = checkExpression(x, definitions);
+        for (const string& same : {"!!" + x, x + " & T", "T & " + x, x + " | F", x + " $ F", x + " & " + x,
+                                   x + " | " + x, x + " | " + x + " & " + x}) {
+            CHECK_EQUAL(checkExpression(same, definitions), size, same);
+        }
+        for (const string& constant : {x + " & !" + x, "!" + x + " & " + x, x + " $ " + x, x + " | !" + x,
+                                       x + " @ !" + x, x + " $ !" + x, x + " & F", x + " | T", x + " @ F",
+                                       "!(" + x + " $ " + x + ")"}) {
+            CHECK_EQUAL(checkExpression(constant, definitions), size_t(1), constant);
+        }
+        for (const string& negated : {"!" + x, x + " @ " + x, x + " @ T", x + " $ T", "T $ " + x}) {
+            checkExpression(negated, definitions);
+        }
+        // Commuted operands share one node, so the expression needs no more nodes than one side.
+        CHECK_EQUAL(checkExpression("(" + x + " & " + y + ") $ (" + y + " & " + x + ")", definitions), size_t(1), x << ", " << y);
+        checkExpression("!(" + x + " @ " + y + ") | (" + x + " $ !" + y + ")", definitions);
+    }
+
+    return testResult("ExpressionDagTest");
+}
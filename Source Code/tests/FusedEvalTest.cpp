@@ -0,0 +1,76 @@
+/*
+ * FusedEvalTest.cpp : Checks that the fused evaluator gives the results and error messages of shuntingYard
+ *                     followed by evalPostfix, for well-formed and malformed expressions alike.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <random>                 // Include the library for seeded random numbers.
+#include <string>                 // Include the library for string manipulation.
+#include <exception>              // Include the library for standard exceptions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to describe the outcome of an evaluation as its result or its error message.
+template <typename Evaluate>
+static string outcome(Evaluate evaluate) {
+    try {
+        return evaluate() ? "True" : "False";
+    } catch (exception& e) {
+        return string("Error: ") + e.what();
+    }
+}
+
+// Function to check that both evaluators agree on an expression, with either definitions.
+static void checkParity(const string& expression, const BooleanDefinitions& definitions, EvalScratch& scratch) {
+    string expected = outcome([&]() { return evalPostfix(shuntingYard(expression, definitions), definitions); });
+    CHECK_EQUAL(outcome([&]() { return evaluateExpression(expression, scratch, definitions); }), expected,
+                "\"" << expression << "\"");
+}
+
+int main() {
+    BooleanDefinitions definitions;
+    BooleanDefinitions custom;    // Other letters, so T and F are invalid characters.
+    custom.trueDef = 'Y';
+    custom.falseDef = 'N';
+    EvalScratch scratch;
+
+    // Each malformed shape the parser or the evaluator rejects, and a few it accepts.
+    const char* cases[] = {
+        "", " ", "\t\n", "A &", "&A", "& T", "(T", "T)", "((T)", "(T))", "!", "!!", "T !", "T !F", "TT", "T F",
+        "T # F", "T ^ F", "1", "T & 0", "T &", "T & (", "!(", "(", ")", "()", "()&T", "T&()", "(!)", "!()",
+        "(T)(F)", "(T)(F)&T", "(T)(!)", "T & & F", "T | | F", "T @ $ F", "!!T & !F", "T @ T @ F", "T $ F & T",
+        "(T & F) | !(F $ T)", "  T  ", "\xe9", "T\xe9",
+    };
+    for (const char* expression : cases) {
+        checkParity(expression, definitions, scratch);
+        checkParity(expression, custom, scratch);
+    }
+
+    // Well-formed random expressions, then the same expressions with a character deleted, inserted or replaced.
+    mt19937_64 rng(1414);
+    GeneratorOptions options;
+    options.operands = 12;
+    options.maxDepth = 4;
+    options.notChance = 0.3;
+    ExpressionGenerator generator(options, definitions, rng());
+    const string alphabet = "TF&|@$!() xA";
+    for (int i = 0; i < 3000; ++i) {
+        string expression = generator.next();
+        checkParity(expression, definitions, scratch);
+        size_t at = rng() % expression.size();
+        switch (rng() % 3) {
+            case 0: expression.erase(at, 1); break;
+            case 1: expression.insert(at, 1, alphabet[rng() % alphabet.size()]); break;
+            default: expression[at] = alphabet[rng() % alphabet.size()]; break;
+        }
+        checkParity(expression, definitions, scratch);
+    }
+
+    return testResult("FusedEvalTest");
+}
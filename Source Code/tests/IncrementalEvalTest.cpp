@@ -0,0 +1,115 @@
+/*
+ * IncrementalEvalTest.cpp : Checks incremental re-evaluation against the reference truth table after every change.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "IncrementalEval.h"      // Include the user-defined header file that declares the incremental evaluator.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Function to apply a delta line given as text, returning the error it raised, or "" if it applied.
+static string applyLine(IncrementalEvaluator& evaluator, const string& line, const BooleanDefinitions& definitions) {
+    try {
+        applyDeltaLine(evaluator, line.data(), line.data() + line.size(), definitions);
+        return "";
+    } catch (exception& e) {
+        return e.what();
+    }
+}
+
+// Function to check an expression's evaluator after every step of a Gray-code sweep and of a random stream
+// of delta lines, and that a line failing partway through changes nothing.
+static void checkExpression(const string& expression, const BooleanDefinitions& definitions, mt19937_64& rng) {
+    string variables;
+    vector<bool> rows = referenceTruthTable(expression, definitions, variables);
+    IncrementalEvaluator evaluator(compileExpression(expression, definitions, true));
+    CHECK_EQUAL(evaluator.variables(), variables, expression);
+    CHECK_EQUAL(evaluator.result(), rows[0], expression << ", starting row");
+
+    // Gray-code sweep: each step flips one variable and must land on the next row of the code.
+    for (uint64_t step = 1; step < rows.size(); ++step) {
+        evaluator.toggle(__builtin_ctzll(step));
+        uint64_t row = step ^ (step >> 1);
+        CHECK_EQUAL(evaluator.assignment(), row, expression << ", Gray step " << step);
+        if (evaluator.result() != rows[row]) {
+            CHECK_EQUAL(evaluator.result(), rows[row], expression << ", Gray step " << step);
+            return;               // One report per expression is enough.
+        }
+    }
+    if (variables.empty()) return;
+
+    // Random delta lines setting, clearing and flipping several variables at once, in every accepted spelling.
+    uint64_t expected = evaluator.assignment();
+    for (int step = 0; step < 300; ++step) {
+        string line;
+        for (int change = 1 + rng() % 4; change > 0; --change) {
+            size_t v = rng() % variables.size();
+            switch (rng() % 6) {
+                case 0: line += string(1, variables[v]) + "=1"; expected |= 1ULL << v; break;
+                case 1: line += string(1, variables[v]) + "=0"; expected &= ~(1ULL << v); break;
+                case 2: line += string(1, variables[v]) + "=" + definitions.trueDef; expected |= 1ULL << v; break;
+                case 3: line += string(1, variables[v]) + "=" + definitions.falseDef; expected &= ~(1ULL << v); break;
+                case 4: line += "!" + string(1, variables[v]); expected ^= 1ULL << v; break;
+                case 5: line += "~" + string(1, variables[v]); expected ^= 1ULL << v; break;
+            }
+            line += (rng() % 2) ? " " : ", ";
+        }
+        if (rng() % 8 == 0) line += "\r";  // Windows line endings are ignored.
+        CHECK_EQUAL(applyLine(evaluator, line, definitions), string(), expression << ", line \"" << line << "\"");
+        CHECK_EQUAL(evaluator.assignment(), expected, expression << ", line \"" << line << "\"");
+        if (evaluator.result() != rows[expected]) {
+            CHECK_EQUAL(evaluator.result(), rows[expected], expression << ", line \"" << line << "\"");
+            return;
+        }
+    }
+
+    // Lines that fail after some valid changes must leave the assignment and the result as they were.
+    string first(1, variables[0]);
+    for (const string& line : {first + "=1 !" + first + " ?=1", "!" + first + " " + first + "=2",
+                               first + "=0 " + first, first + "=1 !", "!" + first + " " + first + "=1 %"}) {
+        uint64_t before = evaluator.assignment();
+        bool result = evaluator.result();
+        CHECK(applyLine(evaluator, line, definitions) != "");
+        CHECK_EQUAL(evaluator.assignment(), before, expression << ", failed line \"" << line << "\"");
+        CHECK_EQUAL(evaluator.result(), result, expression << ", failed line \"" << line << "\"");
+        evaluator.toggle(rng() % variables.size());  // Move on, so the next line starts somewhere else.
+        CHECK_EQUAL(evaluator.result(), rows[evaluator.assignment()], expression << ", after failed line");
+    }
+}
+
+int main() {
+    BooleanDefinitions definitions;
+    mt19937_64 rng(31337);
+
+    // Constants, repeated variables and shared subexpressions, where updates stop or meet early.
+    for (const char* expression : {"T", "F", "A", "!A", "A $ A", "A @ A", "!(A & !A)", "A & B", "A | B | C",
+                                   "(A & B) $ (A & B)", "!(A @ B) | (C $ D) & !E", "T & A | F $ B",
+                                   "((A $ B) $ (C $ D)) $ ((E $ G) $ (H $ I))"}) {
+        checkExpression(expression, definitions, rng);
+    }
+
+    // Random expressions of growing size over up to ten variables.
+    for (size_t operands : {2, 6, 16, 40, 120}) {
+        GeneratorOptions options;
+        options.operands = operands;
+        options.maxDepth = 8;
+        options.notChance = 0.3;
+        options.variables = "ABCDEGHIJK";
+        options.variableChance = 0.8;
+        ExpressionGenerator generator(options, definitions, rng());
+        for (int i = 0; i < 40; ++i) checkExpression(generator.next(), definitions, rng);
+    }
+
+    return testResult("IncrementalEvalTest");
+}
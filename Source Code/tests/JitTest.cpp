@@ -0,0 +1,183 @@
+/*
+ * JitTest.cpp : Checks the native backend against the sliced interpreter, row by row.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+#include "Jit.h"                  // Include the user-defined header file that declares the native backend.
+#include "ExpressionGenerator.h"  // Include the user-defined header file that declares the expression generator.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+#if BOOLEANLOGIC_JIT
+// Call generated code with every callee-saved register holding a canary, returning how many of them the
+// call changed. Arguments: code, variables, canary, and where to store the result (System V order).
+extern "C" int callWithCanaries(JitExpression::Function code, const uint64_t* variables, uint64_t canary,
+                                uint64_t* result);
+asm(R"(
+    .text
+    .p2align 4
+    .type callWithCanaries, @function
+callWithCanaries:
+    push %rbx
+    push %rbp
+    push %r12
+    push %r13
+    push %r14
+    push %r15
+    sub $24, %rsp
+    mov %rcx, (%rsp)
+    mov %rdx, 8(%rsp)
+    mov %rdx, %rbx
+    mov %rdx, %rbp
+    mov %rdx, %r12
+    mov %rdx, %r13
+    mov %rdx, %r14
+    mov %rdx, %r15
+    mov %rdi, %rax
+    mov %rsi, %rdi
+    call *%rax
+    mov (%rsp), %rcx
+    mov %rax, (%rcx)
+    mov 8(%rsp), %rdx
+    xor %eax, %eax
+    cmp %rdx, %rbx
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    cmp %rdx, %rbp
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    cmp %rdx, %r12
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    cmp %rdx, %r13
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    cmp %rdx, %r14
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    cmp %rdx, %r15
+    setne %cl
+    movzbl %cl, %ecx
+    add %ecx, %eax
+    add $24, %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbp
+    pop %rbx
+    ret
+    .size callWithCanaries, .-callWithCanaries
+)");
+#endif
+
+enum Backend { EITHER, NATIVE, INTERPRETED };  // Which path an expression is expected to take.
+
+// Function to run a program through the JIT and the sliced interpreter on random words, checking that every
+// one of the 64 rows agrees and that the expected backend was used.
+static void checkProgram(const CompiledExpression& program, const string& note, mt19937_64& rng,
+                         Backend backend = EITHER, int trials = 16) {
+    JitExpression jit(program);
+#if BOOLEANLOGIC_JIT
+    if (backend != EITHER) CHECK_EQUAL(jit.isNative(), backend == NATIVE, note);
+#else
+    (void)backend;
+    CHECK(!jit.isNative());       // Builds without the backend always interpret.
+#endif
+    vector<uint64_t> variables(max<size_t>(1, program.variables.size()));
+    vector<uint64_t> stack(program.maxDepth);
+    for (int trial = 0; trial < trials; ++trial) {
+        for (uint64_t& word : variables) word = rng();
+        uint64_t expected = runSlicedProgram<uint64_t>(program.code.data(), program.code.size(), stack.data(),
+                                                       variables.data());
+        uint64_t actual = jit.evaluate(variables.data());
+#if BOOLEANLOGIC_JIT
+        if (jit.isNative()) {     // The generated code must restore every callee-saved register it uses.
+            uint64_t canary = rng(), viaCanaries = 0;
+            CHECK_EQUAL(callWithCanaries(jit.nativeFunction(), variables.data(), canary, &viaCanaries), 0, note);
+            CHECK_EQUAL(viaCanaries, actual, note);
+        }
+#endif
+        if (actual != expected) {
+            int row = __builtin_ctzll(actual ^ expected);
+            CHECK_EQUAL((actual >> row) & 1, (expected >> row) & 1, note << ", row " << row);
+            return;               // One report per program is enough.
+        }
+    }
+}
+
+// Function to build a balanced tree of binary operators over variables, needing depth + 1 registers.
+static string balancedExpression(int depth, mt19937_64& rng) {
+    static const char operators[] = {'&', '|', '@', '$'};
+    static const string letters = "ABCDEGHIJKLMNOPQRS";
+    if (depth == 0) return string(1, letters[rng() % letters.size()]);
+    return "(" + balancedExpression(depth - 1, rng) + " " + operators[rng() % 4] + " " +
+           balancedExpression(depth - 1, rng) + ")";
+}
+
+int main() {
+    BooleanDefinitions definitions;
+    mt19937_64 rng(2718);
+
+    // Programs of a single instruction or operator, including every opcode the emitter handles.
+    for (const char* expression : {"T", "F", "A", "!A", "!T", "!F", "A & B", "A | B", "A @ B", "A $ B",
+                                   "A & A", "A $ A", "!(A @ B)", "T & A", "F | A"}) {
+        checkProgram(compileExpression(expression, definitions, true), expression, rng, NATIVE);
+    }
+
+    // Random programs of many shapes: chains, bushy trees, heavy negation and every operator mix.
+    const size_t shapes[][2] = {{2, 1}, {8, 3}, {32, 6}, {128, 12}, {512, 40}};
+    for (const auto& shape : shapes) {
+        for (double chain : {0.0, 0.5, 1.0}) {
+            GeneratorOptions options;
+            options.operands = shape[0];
+            options.maxDepth = shape[1];
+            options.chainChance = chain;
+            options.notChance = 0.3;
+            options.variables = "ABCDEGHIJKLMNOPQRSUVWXYZabcdefghijklmnopqrstuvwxyz";
+            options.variableChance = 0.8;
+            ExpressionGenerator generator(options, definitions, rng());
+            for (int i = 0; i < 200; ++i) {
+                string expression = generator.next();
+                checkProgram(compileExpression(expression, definitions, true), expression, rng);
+            }
+        }
+    }
+
+    // Balanced trees: depth 7 fits the caller-saved registers, depth 8 to 13 push callee-saved ones, and
+    // depth 13 uses all 14 stack registers. Depth 14 needs 15 and must fall back to the interpreter.
+    for (int depth = 1; depth <= 14; ++depth) {
+        CompiledExpression program = compileExpression(balancedExpression(depth, rng), definitions, true);
+        checkProgram(program, "balanced tree of depth " + to_string(depth), rng,
+                     depth + 1 <= static_cast<int>(JIT_STACK_REGISTERS) ? NATIVE : INTERPRETED, 4);
+    }
+
+    // Programs at the length limit are translated; one instruction more falls back to the interpreter.
+    for (size_t length : {JIT_MAX_INSTRUCTIONS, JIT_MAX_INSTRUCTIONS + 1}) {
+        CompiledExpression program;
+        program.code.assign(length, OP_NOT);  // A variable load followed by a run of negations.
+        program.code[0] = OP_LOAD_VAR;
+        program.code[1] = 0;
+        program.maxDepth = 1;
+        program.variables = "A";
+        checkProgram(program, to_string(length) + " instructions", rng,
+                     length <= JIT_MAX_INSTRUCTIONS ? NATIVE : INTERPRETED, 2);
+    }
+
+    return testResult("JitTest");
+}
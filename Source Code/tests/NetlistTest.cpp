@@ -0,0 +1,230 @@
+/*
+ * NetlistTest.cpp : Checks the netlist simulator against a gate-by-gate scalar reference.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <cstdio>                 // Include the library for removing files.
+#include <algorithm>              // Include the library for shuffling.
+#include <fstream>                // Include the library for reading and writing files.
+#include <random>                 // Include the library for seeded random numbers.
+#include <sstream>                // Include the library for reading a netlist from memory.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Netlist.h"              // Include the user-defined header file that declares the netlist simulator.
+#include "TruthTableSlices.h"     // Include the user-defined header file that declares the row slices.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+static const char* const stimulusPath = "NetlistTest.stim";  // Scratch stimulus file, in the test's directory.
+static const char* const outputPath = "NetlistTest.out";     // Scratch output file, in the test's directory.
+
+struct ReferenceGate {            // Define a structure for a gate of the reference circuit, at full width.
+    GateOp op;                    // Member holding the kind of gate.
+    vector<size_t> inputs;        // Member holding the wires it reads: inputs first, then earlier gates.
+};
+
+struct ReferenceCircuit {         // Define a structure for a random circuit and its netlist text.
+    size_t inputCount = 0;        // Member holding the number of primary inputs.
+    vector<ReferenceGate> gates;  // Member holding the gates, each reading only inputs and earlier gates.
+    vector<size_t> outputs;       // Member holding the wire driving each output.
+    string text;                  // Member holding the netlist, with the gate lines shuffled.
+};
+
+// Function to name a wire of the reference circuit.
+static string wireName(const ReferenceCircuit& circuit, size_t wire) {
+    return wire < circuit.inputCount ? "in" + to_string(wire) : "g" + to_string(wire - circuit.inputCount);
+}
+
+// Function to build a random circuit of wide and narrow gates, written in shuffled order so the simulator has
+// to levelize it, in both the spaced and the parenthesized syntax.
+static ReferenceCircuit randomCircuit(mt19937_64& rng, size_t inputCount, size_t gateCount) {
+    static const char* const kinds[] = {"AND", "OR", "NAND", "XOR", "NOT", "BUF"};
+    ReferenceCircuit circuit;
+    circuit.inputCount = inputCount;
+    vector<string> lines;
+    for (size_t g = 0; g < gateCount; ++g) {
+        ReferenceGate gate;
+        gate.op = static_cast<GateOp>(rng() % 6);
+        size_t fanin = (gate.op == GATE_NOT || gate.op == GATE_BUF) ? 1 : 2 + rng() % 6;
+        for (size_t k = 0; k < fanin; ++k) gate.inputs.push_back(rng() % (inputCount + g));
+        string line = "g" + to_string(g) + " = " + kinds[gate.op];
+        bool parenthesized = rng() % 2;
+        for (size_t k = 0; k < fanin; ++k) {
+            line += parenthesized ? (k ? ", " : "(") : " ";
+            line += wireName(circuit, gate.inputs[k]);
+        }
+        if (parenthesized) line += ")";
+        lines.push_back(line);
+        circuit.gates.push_back(gate);
+    }
+    shuffle(lines.begin(), lines.end(), rng);
+    circuit.text = "# Random circuit\nINPUT";
+    for (size_t i = 0; i < inputCount; ++i) circuit.text += " " + wireName(circuit, i);
+    circuit.text += "\nOUTPUT";
+    for (size_t o = 0; o < 6; ++o) {  // Mostly late gates, and one primary input passed straight through.
+        size_t wire = o == 0 ? rng() % inputCount : inputCount + gateCount - 1 - rng() % min<size_t>(gateCount, 12);
+        circuit.outputs.push_back(wire);
+        circuit.text += " " + wireName(circuit, wire);
+    }
+    circuit.text += "\n";
+    for (const string& line : lines) circuit.text += line + "\n";
+    return circuit;
+}
+
+// Function to evaluate the reference circuit on one vector, one gate at a time, returning the output line.
+static string referenceOutputs(const ReferenceCircuit& circuit, const vector<bool>& values) {
+    vector<bool> wires(values);
+    for (const ReferenceGate& gate : circuit.gates) {
+        bool all = true, any = false, parity = false;
+        for (size_t wire : gate.inputs) {
+            all = all && wires[wire];
+            any = any || wires[wire];
+            parity = parity != wires[wire];
+        }
+        switch (gate.op) {
+            case GATE_AND:  wires.push_back(all); break;
+            case GATE_OR:   wires.push_back(any); break;
+            case GATE_NAND: wires.push_back(!all); break;
+            case GATE_XOR:  wires.push_back(parity); break;
+            case GATE_NOT:  wires.push_back(!wires[gate.inputs[0]]); break;
+            case GATE_BUF:  wires.push_back(wires[gate.inputs[0]]); break;
+        }
+    }
+    string line;
+    for (size_t wire : circuit.outputs) line += wires[wire] ? '1' : '0';
+    return line;
+}
+
+// Function to draw a random input vector.
+static vector<bool> randomVector(mt19937_64& rng, size_t inputCount) {
+    vector<bool> values(inputCount);
+    for (size_t i = 0; i < inputCount; ++i) values[i] = rng() & 1;
+    return values;
+}
+
+// Function to write a vector as a stimulus line, every value followed by a space so all lines are equally long.
+static string stimulusLine(const vector<bool>& values) {
+    string line;
+    for (bool value : values) line += value ? "1 " : "0 ";
+    return line;
+}
+
+// Function to run a stimulus file through runStimulus and return its output lines.
+static vector<string> runStimulusLines(const Netlist& netlist, const string& stimulus, unsigned threads,
+                                       uint64_t& vectors) {
+    {
+        ofstream file(stimulusPath, ios::binary | ios::trunc);
+        file << stimulus;
+    }
+    vectors = runStimulus(netlist, stimulusPath, outputPath, threads);
+    vector<string> lines;
+    ifstream output(outputPath);
+    for (string line; getline(output, line);) lines.push_back(line);
+    return lines;
+}
+
+// Function to check that a netlist is rejected with exactly the given message.
+static void checkNetlistError(const string& text, const string& expected) {
+    string error;
+    try {
+        istringstream in(text);
+        Netlist netlist(in);
+    } catch (exception& e) {
+        error = e.what();
+    }
+    CHECK_EQUAL(error, expected, text);
+}
+
+int main() {
+    mt19937_64 rng(1123);
+
+    for (int trial = 0; trial < 8; ++trial) {
+        ReferenceCircuit circuit = randomCircuit(rng, 3 + trial, 20 + 15 * trial);
+        istringstream in(circuit.text);
+        Netlist netlist(in);
+        CHECK_EQUAL(netlist.inputCount(), circuit.inputCount, "trial " << trial);
+        CHECK_EQUAL(netlist.outputCount(), circuit.outputs.size(), "trial " << trial);
+
+        // Whole slices and partial ones, each lane checked against the reference.
+        for (uint64_t count : {uint64_t(1), uint64_t(63), uint64_t(64), uint64_t(65), SLICE_ROWS - 1, SLICE_ROWS}) {
+            if (count > SLICE_ROWS) continue;  // Builds with 64-row slices cannot hold 65 lanes.
+            vector<RowSlice> wires(netlist.wireCount(), RowSlice{});
+            vector<vector<bool>> vectors;
+            for (uint64_t lane = 0; lane < count; ++lane) {
+                vectors.push_back(randomVector(rng, circuit.inputCount));
+                for (size_t i = 0; i < circuit.inputCount; ++i) {
+                    if (vectors[lane][i]) wires[i][lane / 64] |= 1ULL << (lane % 64);
+                }
+            }
+            netlist.simulate(wires.data());
+            for (uint64_t lane = 0; lane < count; ++lane) {
+                string actual;
+                for (size_t o = 0; o < netlist.outputCount(); ++o) {
+                    actual += ((wires[netlist.outputWire(o)][lane / 64] >> (lane % 64)) & 1) ? '1' : '0';
+                }
+                CHECK_EQUAL(actual, referenceOutputs(circuit, vectors[lane]),
+                            "trial " << trial << ", " << count << " lanes, lane " << lane);
+            }
+        }
+
+        // Whole stimulus files. runStimulus cuts its input into 16 chunks per thread, so with one thread and
+        // equally long lines, 16 * n vectors give every chunk exactly n and the runner packs exactly n lanes.
+        for (uint64_t count : {uint64_t(63), uint64_t(64), uint64_t(65), SLICE_ROWS - 1, SLICE_ROWS, SLICE_ROWS + 1}) {
+            for (uint64_t total : {count, 16 * count}) {
+                string stimulus;
+                vector<string> expected;
+                for (uint64_t k = 0; k < total; ++k) {
+                    vector<bool> values = randomVector(rng, circuit.inputCount);
+                    stimulus += stimulusLine(values) + "\n";
+                    expected.push_back(referenceOutputs(circuit, values));
+                }
+                for (unsigned threads : {1u, 3u}) {
+                    uint64_t vectors = 0;
+                    vector<string> lines = runStimulusLines(netlist, stimulus, threads, vectors);
+                    CHECK_EQUAL(vectors, total, "trial " << trial << ", " << total << " vectors");
+                    CHECK_EQUAL(lines.size(), expected.size(), "trial " << trial << ", " << total << " vectors");
+                    for (size_t k = 0; k < lines.size() && k < expected.size(); ++k) {
+                        CHECK_EQUAL(lines[k], expected[k], "trial " << trial << ", " << total << " vectors, line "
+                                                                   << k << ", " << threads << " threads");
+                    }
+                }
+            }
+        }
+    }
+
+    // Blank lines, indented comments and malformed vectors keep their place in the output.
+    {
+        istringstream in("INPUT a b\nOUTPUT y n\ny = XOR(a, b)\nn = NOT a\n");
+        Netlist netlist(in);
+        string stimulus = "1 1\n\n   \n\t# note\n  # indented\n# comment\n1 0\n1\n1 0 1\n1 2\n0_1\r\n";
+        vector<string> expected = {"00", "", "", "", "", "", "10", "Error: Too few values in stimulus vector",
+                                   "Error: Too many values in stimulus vector",
+                                   "Error: Stimulus values must be 0 or 1", "11"};
+        uint64_t vectors = 0;
+        vector<string> lines = runStimulusLines(netlist, stimulus, 1, vectors);
+        CHECK_EQUAL(vectors, 3u, "mixed stimulus");
+        CHECK_EQUAL(lines.size(), expected.size(), "mixed stimulus");
+        for (size_t k = 0; k < lines.size() && k < expected.size(); ++k) {
+            CHECK_EQUAL(lines[k], expected[k], "mixed stimulus, line " << k);
+        }
+    }
+
+    // Loops are found through narrow and wide gates, and undeclared wires are named with their line.
+    checkNetlistError("INPUT a\nOUTPUT y\ny = AND a z\nz = NOT y\n", "Netlist line 3: Combinational loop through y");
+    checkNetlistError("INPUT a b\nOUTPUT y\ny = OR(a, b, y)\n", "Netlist line 3: Combinational loop through y");
+    checkNetlistError("INPUT a b c\nOUTPUT y\nw = BUF a\ny = XOR w b c x a\nx = NAND y c\n",
+                      "Netlist line 4: Combinational loop through y");
+    checkNetlistError("INPUT a\nOUTPUT y\ny = AND a q\n", "Netlist line 3: Undeclared wire: q");
+    checkNetlistError("INPUT a\nOUTPUT y z\ny = BUF a\n", "Netlist line 2: Undeclared output: z");
+    checkNetlistError("INPUT a a\nOUTPUT a\n", "Netlist line 1: Wire declared twice: a");
+
+    remove(stimulusPath);
+    remove(outputPath);
+    return testResult("NetlistTest");
+}
@@ -0,0 +1,15 @@
+/*
+ * StaticExpressionMalformed.cpp : Must not compile; ctest checks the compiler names the parse error.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include "StaticExpression.h"     // Include the user-defined header file that defines compile-time expressions.
+
+STATIC_BOOLEAN_EXPRESSION(Malformed, "A & ");  // Missing operand after operator.
+
+int main() {
+    return Malformed::evaluate();
+}
@@ -0,0 +1,151 @@
+/*
+ * StaticExpressionTest.cpp : Checks compile-time expressions against the runtime parser and interpreters.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <random>                 // Include the library for seeded random numbers.
+#include <stdexcept>              // Include the library for standard exceptions.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "Bytecode.h"             // Include the user-defined header file that declares compiled expressions.
+#include "TruthTable.h"           // Include the user-defined header file that declares the sliced interpreter.
+#include "StaticExpression.h"     // Include the user-defined header file that defines compile-time expressions.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+// Bit i of an assignment holds variable i, with variables sorted like compilePostfix sorts them.
+STATIC_BOOLEAN_EXPRESSION(Policy, "(A & B) | !C");
+static_assert(Policy::evaluate(0b000) && !Policy::evaluate(0b100) && Policy::evaluate(0b111), "Policy");
+
+// NOT binds tightest and is right associative, so a double negation cancels.
+STATIC_BOOLEAN_EXPRESSION(DoubleNot, "!!A");
+static_assert(!DoubleNot::evaluate(0) && DoubleNot::evaluate(1), "!!A is A");
+STATIC_BOOLEAN_EXPRESSION(NotAnd, "!A & B");
+static_assert(!NotAnd::evaluate(0b00) && NotAnd::evaluate(0b10), "!A & B is (!A) & B");
+
+// AND and XOR bind tighter than OR and NAND.
+STATIC_BOOLEAN_EXPRESSION(OrAnd, "A|B&C");
+static_assert(OrAnd::evaluate(0b001) && !OrAnd::evaluate(0b010) && OrAnd::evaluate(0b110), "A|B&C is A|(B&C)");
+STATIC_BOOLEAN_EXPRESSION(NandOr, "T@F|T");
+static_assert(NandOr::evaluate(), "T@F|T is (T@F)|T");
+
+// Operators of equal precedence group from the left.
+STATIC_BOOLEAN_EXPRESSION(XorAnd, "A$B&C");
+static_assert(!XorAnd::evaluate(0b001) && XorAnd::evaluate(0b101), "A$B&C is (A$B)&C");
+STATIC_BOOLEAN_EXPRESSION(NandChain, "T@T@F");
+static_assert(NandChain::evaluate(), "T@T@F is (T@T)@F");
+
+// Variables are indexed in sorted order, whatever order they appear in.
+STATIC_BOOLEAN_EXPRESSION(Indexed, "b & Z | !A");
+static_assert(Indexed::variableCount == 3, "three variables");
+static_assert(Indexed::variable('A') == 0 && Indexed::variable('Z') == 1 && Indexed::variable('b') == 2, "sorted");
+
+// Other true and false characters, and literal-only parsing.
+STATIC_BOOLEAN_EXPRESSION(Custom, "X & !Y", 'X', 'Y', false);
+static_assert(Custom::variableCount == 0 && Custom::evaluate(), "X is true and Y is false");
+
+// Sliced evaluation works on whole words at compile time.
+constexpr uint64_t slicedInputs[] = {0b1100, 0b1010};
+STATIC_BOOLEAN_EXPRESSION(AndNot, "A & !B");
+static_assert(AndNot::evaluateSliced(slicedInputs) == 0b0100, "64 rows at once");
+static_assert(NotAnd::evaluateSliced(slicedInputs) == 0b0010, "64 rows at once");
+
+// A malformed literal does not compile; tests/StaticExpressionMalformed.cpp is built by ctest and must fail
+// with the parser's message.
+
+STATIC_BOOLEAN_EXPRESSION(Mixed, "(A @ !(B $ C)) | (D & E $ !F) @ (G | H & T)");
+STATIC_BOOLEAN_EXPRESSION(Spaced, "  !( A|B )\t&\n( C @ D ) $ F ");
+
+// Function to compare a compile-time expression with the runtime parser on every assignment, and with the
+// sliced interpreter on random words.
+template <typename Expression>
+static void checkAgainstRuntime(const char* text, mt19937_64& rng) {
+    BooleanDefinitions definitions;
+    CompiledExpression program = compileExpression(text, definitions, true);
+    CHECK_EQUAL(program.variables.size(), Expression::variableCount, text);
+    vector<uint8_t> stack;
+    for (uint64_t assignment = 0; assignment < (1ULL << program.variables.size()); ++assignment) {
+        CHECK_EQUAL(Expression::evaluate(assignment), runProgram(program, stack, assignment), text << ", row " << assignment);
+    }
+    vector<uint64_t> words(max<size_t>(1, program.variables.size()));
+    vector<uint64_t> slicedStack(program.maxDepth);
+    for (int trial = 0; trial < 16; ++trial) {
+        for (uint64_t& word : words) word = rng();
+        CHECK_EQUAL(Expression::evaluateSliced(words.data()),
+                    runSlicedProgram(program.code.data(), program.code.size(), slicedStack.data(), words.data()), text);
+    }
+}
+
+// Function to describe the error an evaluation throws, with its type, or "" if it succeeds.
+template <typename Evaluate>
+static string errorOf(Evaluate evaluate) {
+    try {
+        evaluate();
+    } catch (invalid_argument& e) {
+        return string("invalid_argument: ") + e.what();
+    } catch (exception& e) {
+        return string("runtime_error: ") + e.what();
+    }
+    return "";
+}
+
+// Function to check that a malformed literal fails to parse at compile time with exactly the error the runtime
+// parser and evaluator give.
+template <size_t N>
+static void checkSameError(const char (&text)[N]) {
+    BooleanDefinitions definitions;
+    string runtime = errorOf([&]() { evalPostfix(shuntingYard(text, definitions), definitions); });
+    string compileTime = errorOf([&]() { compileStatic(text, definitions.trueDef, definitions.falseDef, false); });
+    CHECK(!runtime.empty());
+    CHECK_EQUAL(compileTime, runtime, '"' << text << '"');
+}
+
+int main() {
+    mt19937_64 rng(31415);
+
+    // Every kind of malformed literal, including those evalPostfix rejects after shuntingYard accepts them.
+    checkSameError("");
+    checkSameError("   ");
+    checkSameError("& T");
+    checkSameError("T | | F");
+    checkSameError("T &@ F");
+    checkSameError("T & ($ F)");
+    checkSameError("T &");
+    checkSameError("!");
+    checkSameError("T !");
+    checkSameError("T ! F");
+    checkSameError("(T)!");
+    checkSameError("T F");
+    checkSameError("(T) F");
+    checkSameError("() T");
+    checkSameError("T)");
+    checkSameError(")");
+    checkSameError("(T");
+    checkSameError("((T & F)");
+    checkSameError("()");
+    checkSameError("( )");
+    checkSameError("!()");
+    checkSameError("(T & )");
+    checkSameError("() & T");
+    checkSameError("T & () | F");
+    checkSameError("T # F");
+    checkSameError("T & 1");
+    checkSameError("T & A");
+    checkAgainstRuntime<Policy>("(A & B) | !C", rng);
+    checkAgainstRuntime<DoubleNot>("!!A", rng);
+    checkAgainstRuntime<NotAnd>("!A & B", rng);
+    checkAgainstRuntime<OrAnd>("A|B&C", rng);
+    checkAgainstRuntime<NandOr>("T@F|T", rng);
+    checkAgainstRuntime<XorAnd>("A$B&C", rng);
+    checkAgainstRuntime<NandChain>("T@T@F", rng);
+    checkAgainstRuntime<Indexed>("b & Z | !A", rng);
+    checkAgainstRuntime<AndNot>("A & !B", rng);
+    checkAgainstRuntime<Mixed>("(A @ !(B $ C)) | (D & E $ !F) @ (G | H & T)", rng);
+    checkAgainstRuntime<Spaced>("  !( A|B )\t&\n( C @ D ) $ F ", rng);
+    return testResult("StaticExpressionTest");
+}
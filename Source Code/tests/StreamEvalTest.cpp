@@ -0,0 +1,101 @@
+/*
+ * StreamEvalTest.cpp : Checks streamed evaluation's results, error messages and byte offsets, and that its
+ *                      stacks stay bounded for long inputs, including erroneous ones.
+ *
+ * Creation Date: October 17, 2026
+ * Modification Date: October 17, 2026
+ *
+ */
+
+#include <cstdio>                 // Include the library for removing files.
+#include <fstream>                // Include the library for writing input files.
+#include <string>                 // Include the library for string manipulation.
+#include <exception>              // Include the library for standard exceptions.
+#include "FastEval.h"             // Include the user-defined header file that declares the fused evaluator.
+#include "StreamEval.h"           // Include the user-defined header file that declares streaming evaluation.
+#include "TestSupport.h"          // Include the test helpers.
+
+using namespace std;              // Use the standard namespace to avoid prefixing with std::.
+
+const char* const STREAM_FILE = "StreamEvalTest.input";  // Scratch file in the test's working directory.
+
+// Function to stream an expression from a file and describe the outcome as its result or its error message.
+static string streamOutcome(const string& expression, const BooleanDefinitions& definitions, StreamStats& stats) {
+    ofstream(STREAM_FILE, ios::binary) << expression;
+    try {
+        return evaluateStream(STREAM_FILE, definitions, stats) ? "True" : "False";
+    } catch (exception& e) {
+        return string("Error: ") + e.what();
+    }
+}
+
+// Function to describe the outcome of shuntingYard and evalPostfix on an expression.
+static string referenceOutcome(const string& expression, const BooleanDefinitions& definitions) {
+    try {
+        return evalPostfix(shuntingYard(expression, definitions), definitions) ? "True" : "False";
+    } catch (exception& e) {
+        return string("Error: ") + e.what();
+    }
+}
+
+// Function to check a streamed expression against the reference, with the byte offset the error must name,
+// or -1 when the error is only found at the end of the input.
+static void checkStream(const string& expression, long offset, const BooleanDefinitions& definitions) {
+    StreamStats stats;
+    string expected = referenceOutcome(expression, definitions);
+    if (offset >= 0) expected += " (at byte " + to_string(offset) + ")";
+    string note = expression.size() > 40 ? expression.substr(0, 40) + "..." : expression;
+    CHECK_EQUAL(streamOutcome(expression, definitions, stats), expected, "\"" << note << "\"");
+}
+
+int main() {
+    BooleanDefinitions definitions;
+
+    // Errors found while reading name the offending byte; the rest are found at the end and name none.
+    checkStream("&A", 0, definitions);
+    checkStream("A &", 0, definitions);
+    checkStream("T)", 1, definitions);
+    checkStream("TT", 1, definitions);
+    checkStream("T # F", 2, definitions);
+    checkStream("T & F\nT", 6, definitions);
+    checkStream("T !F", 2, definitions);
+    checkStream("(T", -1, definitions);
+    checkStream("!", -1, definitions);
+    checkStream("T &", -1, definitions);
+    checkStream("", -1, definitions);
+    checkStream("()", -1, definitions);
+    checkStream("()&T", -1, definitions);
+    checkStream("(T & F) | !(F $ T)\n", -1, definitions);
+
+    // Offsets stay exact past the end of the first read chunk.
+    string chain = "T";
+    while (chain.size() < (3 << 20)) chain += " & T";
+    checkStream(chain, -1, definitions);
+    checkStream(chain + " #", static_cast<long>(chain.size() + 1), definitions);
+    checkStream(chain + ")", static_cast<long>(chain.size()), definitions);
+
+    // A long flat expression needs only a few stack entries, however long it is.
+    StreamStats stats;
+    CHECK_EQUAL(streamOutcome(chain, definitions, stats), "True", "long chain");
+    CHECK(stats.bytes == chain.size());
+    CHECK(stats.stackBytes < 256);
+
+    // After an operator finds too few operands, the rest of the input is only parsed, so it does not grow the
+    // value stack either, and the deferred error is still the one reported.
+    string erroneous = "()" + chain.substr(1);
+    EvalScratch scratch;
+    FusedEvaluator evaluator(scratch, definitions);
+    for (char c : erroneous) evaluator.feed(c);
+    string message;
+    try {
+        evaluator.finish();
+    } catch (exception& e) {
+        message = e.what();
+    }
+    CHECK_EQUAL(message, string("Missing operand for binary operator"), "long erroneous chain");
+    CHECK(scratch.values.capacity() < 256);
+    checkStream(erroneous, -1, definitions);
+
+    remove(STREAM_FILE);
+    return testResult("StreamEvalTest");
+}
@@ -0,0 +1,77 @@
+#ifndef TESTSUPPORT_H
+#define TESTSUPPORT_H
+
+#include <algorithm>              // Include the library for sorting.
+#include <cctype>                 // Include the library for character classification functions.
+#include <cstdint>                // Include the library for fixed-width integer types.
+#include <iostream>               // Include the library for input and output streaming.
+#include <string>                 // Include the library for string manipulation.
+#include <vector>                 // Include the library for the dynamic array container.
+#include "BooleanDefinitions.h"   // Include the user-defined header file that defines true and false.
+#include "FileParse.h"            // Include the user-defined header file that declares shuntingYard.
+#include "PostfixEval.h"          // Include the user-defined header file that declares evalPostfix.
+
+// Number of failed checks in the running test program.
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+// Record a failed check with its location, without stopping the test, so one run reports every failure.
+#define CHECK(condition)                                                                       \
+    do {                                                                                       \
+        if (!(condition)) {                                                                    \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition "\n";   \
+            ++testFailures();                                                                  \
+        }                                                                                      \
+    } while (0)
+
+// Record a failed comparison, printing both values and a note describing the case.
+#define CHECK_EQUAL(actual, expected, note)                                                    \
+    do {                                                                                       \
+        const auto& checkActual = (actual);                                                    \
+        const auto& checkExpected = (expected);                                                \
+        if (!(checkActual == checkExpected)) {                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " << #actual << " is " << checkActual \
+                      << ", expected " << checkExpected << " (" << note << ")\n";              \
+            ++testFailures();                                                                  \
+        }                                                                                      \
+    } while (0)
+
+// Evaluate an expression on every assignment of its variables with the original shuntingYard and evalPostfix,
+// substituting the true and false characters for the variables. Row i assigns variable v (in the sorted order
+// the compiled forms use) the value of bit v of i. Returns the variable names through variables.
+inline std::vector<bool> referenceTruthTable(const std::string& expression, const BooleanDefinitions& definitions,
+                                             std::string& variables) {
+    std::string postfix = shuntingYard(expression, definitions, true);
+    variables.clear();
+    for (char c : postfix) {
+        if (isalpha(static_cast<unsigned char>(c)) && c != definitions.trueDef && c != definitions.falseDef &&
+            variables.find(c) == std::string::npos) {
+            variables += c;
+        }
+    }
+    std::sort(variables.begin(), variables.end());
+    std::vector<bool> rows(size_t(1) << variables.size());
+    std::string substituted = postfix;
+    for (uint64_t row = 0; row < rows.size(); ++row) {
+        for (size_t i = 0; i < postfix.size(); ++i) {
+            size_t v = variables.find(postfix[i]);
+            if (v != std::string::npos) substituted[i] = ((row >> v) & 1) ? definitions.trueDef : definitions.falseDef;
+        }
+        rows[row] = evalPostfix(substituted, definitions);
+    }
+    return rows;
+}
+
+// Report the outcome and return the process exit code.
+inline int testResult(const char* name) {
+    if (testFailures() == 0) {
+        std::cout << name << ": all checks passed" << std::endl;
+        return 0;
+    }
+    std::cerr << name << ": " << testFailures() << " checks failed" << std::endl;
+    return 1;
+}
+
+#endif // TESTSUPPORT_H